@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "graph.hpp"
+
+// Contraction hierarchy over a static undirected graph. Vertices are contracted one by one in order of
+// importance, shortcuts keep the distances between the remaining ones, and a query only climbs upwards
+// in rank from both ends
+template <typename VertexId, typename WeightType>
+class ContractionHierarchy {
+  private:
+
+    static constexpr uint32_t no_middle = std::numeric_limits<uint32_t>::max();
+
+    std::vector<VertexId> vertex_ids_;
+
+    HashTable<VertexId, uint32_t> index_;
+
+    std::vector<uint32_t> rank_;
+
+    // Upward graph in CSR form; each edge leads to a higher ranked vertex
+    std::vector<size_t> up_offsets_;
+    std::vector<uint32_t> up_targets_;
+    std::vector<WeightType> up_weights_;
+    std::vector<uint32_t> up_middles_; // contracted vertex a shortcut skips, no_middle for original edges
+
+    size_t shortcut_count_ = 0;
+
+    void build_index();
+    uint32_t middle_of(uint32_t a, uint32_t b) const;
+
+  public:
+
+    // Reusable search state, so repeated queries allocate nothing; one per thread
+    class Query {
+      private:
+        const ContractionHierarchy* hierarchy_;
+
+        std::vector<WeightType> distances_[2];
+        std::vector<uint32_t> parents_[2];
+        std::vector<uint32_t> stamps_[2]; // entries are valid only if stamped with the current epoch
+        std::vector<std::pair<WeightType, uint32_t>> heaps_[2];
+        uint32_t epoch_ = 0;
+        size_t settled_ = 0;
+
+        std::pair<WeightType, uint32_t> search(uint32_t source, uint32_t target);
+
+      public:
+        explicit Query(const ContractionHierarchy& hierarchy);
+
+        // numeric_limits<WeightType>::max() if target is unreachable
+        WeightType distance(const VertexId& source, const VertexId& target);
+        PathResult<VertexId, WeightType> shortest_path(const VertexId& source, const VertexId& target);
+    };
+
+    ContractionHierarchy() = default;
+
+    static ContractionHierarchy build(const CsrGraph<VertexId, WeightType>& graph);
+    template <typename Resource>
+    static ContractionHierarchy build(const Graph<VertexId, Resource, WeightType>& graph);
+
+    // Binary index file; requires trivially copyable ids and weights. load checks counts, ranks and
+    // every upward edge, and throws std::runtime_error on a malformed file
+    void save(const std::string& filename) const;
+    static ContractionHierarchy load(const std::string& filename);
+
+    WeightType distance(const VertexId& source, const VertexId& target) const;
+    PathResult<VertexId, WeightType> shortest_path(const VertexId& source, const VertexId& target) const;
+
+    size_t vertex_count() const noexcept { return vertex_ids_.size(); }
+    size_t shortcut_count() const noexcept { return shortcut_count_; }
+    size_t upward_edge_count() const noexcept { return up_targets_.size(); }
+    uint32_t rank_of(const VertexId& id) const;
+};
+
+
+#include "../src/contraction_hierarchy.tpp"
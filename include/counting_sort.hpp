@@ -0,0 +1,11 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Stable sort of vertex indices by key(vertex) in [0, max_key], largest key first, in O(n + max_key)
+template <typename Key>
+void counting_sort_descending(std::vector<uint32_t>& vertices, size_t max_key, Key key);
+
+
+#include "../src/counting_sort.tpp"
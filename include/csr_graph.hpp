@@ -0,0 +1,245 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "vertex.hpp"
+#include "parallel.hpp"
+#include "mapped_file.hpp"
+#include "priority_queues.hpp"
+#include "counting_sort.hpp"
+
+// Results of algorithms on CsrGraph are indexed by dense vertex index
+struct CsrTraversal {
+    std::vector<uint32_t> order;
+    std::vector<int> discovery_time; // -1 -> not reached
+    std::vector<int> finish_time;
+};
+
+template <typename WeightType>
+struct CsrShortestPaths {
+    std::vector<WeightType> distances; // numeric_limits::max() -> not reached
+    std::vector<uint32_t> previous;    // vertex is its own predecessor if it's the source or not reached
+};
+
+struct CsrBfsTree {
+    std::vector<int> levels;        // -1 -> not reached
+    std::vector<uint32_t> parents;  // vertex is its own parent if it's the source or not reached
+};
+
+// Row-major sources x vertices table, numeric_limits<DistanceType>::max() -> not reached
+template <typename DistanceType>
+struct DistanceMatrix {
+    std::vector<uint32_t> sources; // dense index of the source of every row
+    size_t vertex_count = 0;
+    std::vector<DistanceType> distances;
+
+    std::span<const DistanceType> row(size_t source_row) const {
+        return {distances.data() + source_row * vertex_count, vertex_count};
+    }
+    DistanceType at(size_t source_row, uint32_t vertex) const {
+        return distances[source_row * vertex_count + vertex];
+    }
+};
+
+// Vertex orders for sequential greedy coloring
+enum class ColoringOrder {
+    largest_first,  // by degree, highest first
+    smallest_last,  // reverse of repeatedly removing a minimum degree vertex
+    saturation      // DSatur: next is the vertex seeing the most distinct colors
+};
+
+struct CsrComponents {
+    size_t count = 0;
+    std::vector<uint32_t> labels;
+};
+
+// Single points of failure and the pieces they separate
+struct CsrBiconnectivity {
+    std::vector<std::pair<uint32_t, uint32_t>> bridges; // (u, v) with u < v, ascending
+    std::vector<uint32_t> articulation_points;          // ascending
+    CsrComponents two_edge_components;                  // components once the bridges are removed
+    size_t block_count = 0;
+    std::vector<uint32_t> edge_blocks;                  // biconnected component of every CSR edge position,
+                                                        // numbered in order of their first position
+};
+
+// Mate of every vertex, unmatched -> none
+struct CsrMatching {
+    static constexpr uint32_t unmatched = std::numeric_limits<uint32_t>::max();
+
+    size_t size = 0; // matched pairs
+    std::vector<uint32_t> mates;
+};
+
+// Minimum spanning forest; every edge is stored as (u, v, weight) with u < v
+template <typename WeightType>
+struct CsrSpanningForest {
+    WeightType total_weight = 0;
+    std::vector<std::tuple<uint32_t, uint32_t, WeightType>> edges;
+};
+
+
+// Immutable compressed sparse row snapshot of an undirected graph
+template <typename VertexId, typename WeightType>
+class CsrGraph {
+  private:
+
+    // Owned storage; left empty when the graph views a mapped file instead
+    std::vector<size_t> offsets_storage_;
+    std::vector<uint32_t> neighbors_storage_;
+    std::vector<WeightType> weights_storage_;
+    std::vector<VertexId> vertex_ids_storage_;
+
+    std::shared_ptr<const MappedFile> mapping_;
+
+    std::span<const size_t> offsets_;
+
+    std::span<const uint32_t> neighbors_;
+
+    std::span<const WeightType> weights_;
+
+    std::span<const VertexId> vertex_ids_;
+
+    std::span<const uint8_t> payload_flags_;
+
+    const std::byte* payloads_ = nullptr;
+
+    size_t payload_size_ = 0;
+
+    // Sorted ids are looked up by binary search, so no hash index has to be built
+    bool sorted_ids_ = false;
+
+    HashTable<VertexId, uint32_t> index_;
+
+    void bind_storage();
+    void build_index();
+    void require_non_negative_weights(const std::string& algorithm) const;
+    // 0/1 side of every vertex, throws if there is an odd cycle
+    std::vector<uint8_t> bipartite_sides() const;
+    // Karp-Sipser: matches degree one vertices first, then arbitrary edges
+    CsrMatching initial_matching() const;
+    // Lock-free union-find: roots are only hooked under a smaller index, so every tree stays rooted
+    // at its smallest element
+    static void link_roots(std::vector<uint32_t>& parents, uint32_t u, uint32_t v);
+    static void compress_roots(std::vector<uint32_t>& parents, size_t thread_count);
+    // Components numbered by their smallest vertex, from compressed parents
+    static CsrComponents label_roots(const std::vector<uint32_t>& parents, size_t thread_count);
+    // Everything but the tree from a spanning forest (roots are their own parent), an order with
+    // ancestors first and the block of every tree edge, named by its child
+    CsrBiconnectivity finish_biconnectivity(const std::vector<uint32_t>& parents, const std::vector<uint32_t>& order,
+                                            const std::vector<uint32_t>& tree_blocks, size_t thread_count) const;
+    // palette needs max_degree() / 64 + 1 words
+    size_t first_free_color(uint32_t vertex, const std::vector<size_t>& colors, std::vector<uint64_t>& palette) const;
+    void write_binary(const std::string& filename, const std::byte* payloads,
+                      const uint8_t* payload_flags, size_t payload_size) const;
+
+  public:
+
+    static constexpr size_t no_color = std::numeric_limits<size_t>::max();
+
+    CsrGraph();
+    CsrGraph(std::vector<VertexId> vertex_ids, std::vector<size_t> offsets,
+             std::vector<uint32_t> neighbors, std::vector<WeightType> weights);
+    CsrGraph(const CsrGraph& other);
+    CsrGraph& operator=(const CsrGraph& other);
+    CsrGraph(CsrGraph&& other) noexcept = default;
+    CsrGraph& operator=(CsrGraph&& other) noexcept = default;
+    ~CsrGraph() = default;
+
+    // Bulk construction: validates, drops duplicate edges (first occurrence wins) and
+    // counting-sorts by source on thread_count workers (0 -> all cores)
+    static CsrGraph from_edge_list(std::span<const std::tuple<VertexId, VertexId, WeightType>> edges,
+                                   size_t thread_count = 0);
+
+    // Versioned binary format (see GraphFileHeader); requires trivially copyable ids and weights
+    void save_binary(const std::string& filename) const;
+    template <typename Payload>
+    void save_binary(const std::string& filename, std::span<const std::optional<Payload>> payloads) const;
+
+    // Uses the file contents in place: nothing is parsed or copied. By default one O(V + E) pass checks
+    // offsets, neighbor indices and id order; with trusted = true only the header and section bounds
+    // are checked, and a corrupt file is undefined behavior
+    static CsrGraph map_binary(const std::string& filename, bool trusted = false);
+
+    bool is_mapped() const noexcept { return mapping_ != nullptr; }
+
+    // Vertex payload stored in the file, nullptr if the vertex has none
+    template <typename Payload>
+    const Payload* payload(uint32_t index) const;
+
+    size_t vertex_count() const noexcept;
+    size_t edge_count() const noexcept;
+    bool is_empty() const noexcept;
+
+    bool has_vertex(const VertexId& id) const;
+    uint32_t index_of(const VertexId& id) const;
+    const VertexId& id_of(uint32_t index) const;
+
+    size_t degree(uint32_t index) const;
+    size_t max_degree() const;
+    std::span<const uint32_t> neighbors(uint32_t index) const;
+    std::span<const WeightType> weights(uint32_t index) const;
+
+    std::span<const size_t> get_offsets() const noexcept { return offsets_; }
+    std::span<const uint32_t> get_neighbors() const noexcept { return neighbors_; }
+    std::span<const WeightType> get_weights() const noexcept { return weights_; }
+    std::span<const VertexId> get_vertex_ids() const noexcept { return vertex_ids_; }
+
+// Algorithms
+
+    CsrTraversal breadth_first_search(VertexId start) const;
+    // Direction-optimizing BFS: top-down steps over a sparse frontier, bottom-up steps over a
+    // frontier bitmap once the frontier touches a large share of the remaining edges
+    CsrBfsTree parallel_breadth_first_search(VertexId start, size_t thread_count = 0) const;
+    CsrTraversal depth_first_search(VertexId start) const;
+    CsrComponents find_connected_components() const;
+    // Lock-free union-find with Afforest neighbor sampling; labels match find_connected_components
+    CsrComponents parallel_connected_components(size_t thread_count = 0) const;
+    template <template <typename> class Queue = BinaryHeap>
+    CsrShortestPaths<WeightType> dijkstra(VertexId start) const;
+    // Parallel SSSP over buckets of width delta (nullopt -> max weight / average degree);
+    // throws std::invalid_argument unless an explicit delta is positive
+    CsrShortestPaths<WeightType> delta_stepping(VertexId start, std::optional<WeightType> delta = std::nullopt,
+                                                size_t thread_count = 0) const;
+    std::vector<size_t> greedy_coloring(VertexId start) const;
+    std::vector<size_t> ordered_coloring(ColoringOrder order) const;
+    // Color classes one at a time, each filled in largest-first order
+    std::vector<size_t> welsh_powell_coloring() const;
+    // Jones-Plassmann: a vertex is colored once all neighbors of higher random priority are
+    std::vector<size_t> parallel_coloring(size_t thread_count = 0, uint64_t seed = 0) const;
+
+    // Bridges, articulation points and blocks in O(V + E): an iterative low-link DFS, and Tarjan-Vishkin
+    // over a BFS forest for many threads. Both give the same result
+    CsrBiconnectivity biconnectivity() const;
+    CsrBiconnectivity parallel_biconnectivity(size_t thread_count = 0) const;
+
+    // Minimum spanning forests. Ties are broken by (weight, u, v), so kruskal and boruvka return the
+    // same edges in that order; prim returns them in the order they join the tree
+    CsrSpanningForest<WeightType> kruskal(size_t thread_count = 0) const; // edges sorted in parallel
+    CsrSpanningForest<WeightType> prim() const;
+    // Every component hooks along its lightest edge each round, O(log V) rounds
+    CsrSpanningForest<WeightType> boruvka(size_t thread_count = 0) const;
+
+    // Maximum matchings, all starting from a Karp-Sipser matching. kuhn_matching, hopcroft_karp and
+    // parallel_matching require a bipartite graph
+    CsrMatching kuhn_matching() const;                        // one augmenting DFS per vertex, O(VE)
+    CsrMatching hopcroft_karp() const;                        // shortest augmenting paths in phases, O(E sqrt(V))
+    // Pothen-Fan: workers grow vertex-disjoint augmenting DFSs from all free vertices at once
+    CsrMatching parallel_matching(size_t thread_count = 0) const;
+    CsrMatching edmonds_matching() const;                     // blossom contraction for general graphs, O(V^3)
+
+    // Batched sources: one Dijkstra per source spread over the workers, and a bit-parallel BFS that
+    // runs 64 sources per machine word for the unweighted case
+    DistanceMatrix<WeightType> distance_matrix(std::span<const VertexId> sources, size_t thread_count = 0) const;
+    DistanceMatrix<uint32_t> unweighted_distance_matrix(std::span<const VertexId> sources,
+                                                        size_t thread_count = 0) const;
+};
+
+
+#include "../src/csr_graph.tpp"
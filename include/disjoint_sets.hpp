@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Union-find over dense indices with union by size and path halving
+class DisjointSets {
+  private:
+    std::vector<uint32_t> parents_;
+
+    std::vector<uint32_t> sizes_;
+
+    size_t set_count_ = 0;
+
+  public:
+    DisjointSets() = default;
+    explicit DisjointSets(size_t count);
+
+    void reset(size_t count);
+
+    // New singleton set; returns its index
+    uint32_t add();
+
+    uint32_t find(uint32_t element);
+
+    // false if both were already in one set
+    bool unite(uint32_t a, uint32_t b);
+
+    bool same_set(uint32_t a, uint32_t b) { return find(a) == find(b); }
+
+    size_t size() const noexcept { return parents_.size(); }
+    size_t set_count() const noexcept { return set_count_; }
+    size_t set_size(uint32_t element) { return sizes_[find(element)]; }
+};
+
+
+#include "../src/disjoint_sets.tpp"
@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+#include "vertex.hpp"
+
+// Fully dynamic connectivity of Holm, de Lichtenberg and Thorup.
+// Every edge has a level; level i keeps a spanning forest of the edges with level >= i as Euler tour
+// treaps. Deleting a tree edge searches the smaller half for a replacement and pushes every edge it
+// looks at one level up, so updates are amortized O(log^2 n) and queries O(log n)
+template <typename VertexId>
+class DynamicConnectivity {
+  private:
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    // Own flags of a treap node, OR-ed over its subtree so flagged nodes are found from the root
+    static constexpr uint8_t tree_edge_flag = 1; // arc of a tree edge whose level is this level
+    static constexpr uint8_t non_tree_flag = 2;  // vertex with non-tree edges of this level
+
+    // Euler tour element: vertex nodes have from == to, every tree edge has one arc per direction
+    struct Node {
+        uint32_t left = none;
+        uint32_t right = none;
+        uint32_t parent = none;
+        uint32_t priority = 0;
+        uint32_t size = 1;
+        uint32_t vertex_count = 0;
+        uint32_t from = 0;
+        uint32_t to = 0;
+        uint8_t flags = 0;
+        uint8_t subtree_flags = 0;
+    };
+
+    struct EdgeInfo {
+        uint32_t level = 0;
+        bool tree = false;
+        // Positions in the non-tree lists of the smaller and the larger endpoint
+        uint32_t low_position = 0;
+        uint32_t high_position = 0;
+    };
+
+    struct Level {
+        HashTable<uint32_t, uint32_t> vertex_nodes; // a vertex without a node is alone at this level
+        HashTable<uint64_t, uint32_t> arcs;
+        HashTable<uint32_t, std::vector<uint32_t>> non_tree;
+    };
+
+    std::vector<Node> nodes_;
+
+    std::vector<uint32_t> free_nodes_;
+
+    std::vector<Level> levels_;
+
+    HashTable<uint64_t, EdgeInfo> edges_;
+
+    HashTable<VertexId, uint32_t> ids_;
+
+    std::vector<uint32_t> free_ids_;
+
+    uint32_t next_id_ = 0;
+
+    size_t tree_edge_count_ = 0;
+
+    std::mt19937 rng_;
+
+    static uint64_t key(uint32_t a, uint32_t b) { return (uint64_t(a) << 32) | b; }
+    static uint64_t edge_key(uint32_t a, uint32_t b) { return a < b ? key(a, b) : key(b, a); }
+
+    uint32_t id_of(const VertexId& vertex) const;
+
+    // Treap primitives; roots have parent == none
+    uint32_t make_node(uint32_t from, uint32_t to);
+    void free_node(uint32_t node);
+    void pull(uint32_t node);
+    uint32_t merge(uint32_t a, uint32_t b);
+    std::pair<uint32_t, uint32_t> split(uint32_t root, uint32_t count);
+    uint32_t root_of(uint32_t node) const;
+    uint32_t position_of(uint32_t node) const;
+    uint32_t reroot(uint32_t node);
+    void set_flag(uint32_t node, uint8_t flag, bool on);
+    uint32_t find_flagged(uint32_t root, uint8_t flag) const;
+
+    // Forest of one level
+    uint32_t vertex_node(uint32_t level, uint32_t vertex);
+    bool connected_at(uint32_t level, uint32_t a, uint32_t b) const;
+    void link(uint32_t level, uint32_t a, uint32_t b, bool edge_level);
+    void cut(uint32_t level, uint32_t a, uint32_t b);
+    void add_non_tree(uint32_t level, uint32_t a, uint32_t b);
+    void remove_non_tree(uint32_t level, uint32_t a, uint32_t b);
+    bool replace(uint32_t level, uint32_t a, uint32_t b);
+
+  public:
+    DynamicConnectivity() = default;
+
+    void add_vertex(const VertexId& vertex);
+    // The vertex must not have edges left
+    void remove_vertex(const VertexId& vertex);
+    void add_edge(const VertexId& u, const VertexId& v);
+    void remove_edge(const VertexId& u, const VertexId& v);
+    void clear();
+
+    bool connected(const VertexId& u, const VertexId& v) const;
+    size_t component_size(const VertexId& vertex) const;
+    size_t component_count() const noexcept { return ids_.size() - tree_edge_count_; }
+    size_t level_count() const noexcept { return levels_.size(); }
+};
+
+
+#include "../src/dynamic_connectivity.tpp"
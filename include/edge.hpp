@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 template <typename VertexId, typename W>
 class Edge {
@@ -11,6 +12,11 @@ class Edge {
     
     bool is_bridge_ = false;
 
+    // Dense slots of the endpoints, kept in sync by Graph
+    uint32_t from_slot_ = 0;
+
+    uint32_t to_slot_ = 0;
+
   public:
 
     Edge() : from_(), to_(), weight_() {}
@@ -39,6 +45,11 @@ class Edge {
 
     bool is_bridge() const noexcept;
     void set_bridge(bool value = true);
+
+    uint32_t get_from_slot() const noexcept;
+    uint32_t get_to_slot() const noexcept;
+    uint32_t opposite_slot(uint32_t slot) const noexcept;
+    void set_slots(uint32_t from_slot, uint32_t to_slot) noexcept;
 };
 
 
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "edge.hpp"
+
+// Slab allocator for the edges of one graph.
+// Edges live in large chunks and never move, so a raw Edge* is a stable handle shared by both directions.
+// The graph hands out const handles; writes come back through the arena so the weight counters stay right
+template <typename VertexId, typename W>
+class EdgeArena {
+  private:
+    static constexpr size_t min_chunk_size_ = 256;
+    static constexpr size_t max_chunk_size_ = size_t(1) << 20;
+
+    std::vector<std::unique_ptr<Edge<VertexId, W>[]>> chunks_;
+
+    size_t chunk_capacity_ = 0;
+
+    size_t chunk_used_ = 0;
+
+    std::vector<Edge<VertexId, W>*> free_list_;
+
+    size_t live_count_ = 0;
+
+    // Kept up to date on every create/release/reweight, so algorithms don't have to scan the edges
+    size_t negative_count_ = 0;
+
+    W max_weight_ = W(0);
+
+    void add_chunk(size_t capacity);
+
+  public:
+    EdgeArena() = default;
+    EdgeArena(const EdgeArena&) = delete;
+    EdgeArena& operator=(const EdgeArena&) = delete;
+    EdgeArena(EdgeArena&& other) noexcept;
+    EdgeArena& operator=(EdgeArena&& other) noexcept;
+    ~EdgeArena() = default;
+
+    Edge<VertexId, W>* create(VertexId from, VertexId to, W weight);
+    void release(const Edge<VertexId, W>* edge);
+    void reweight(const Edge<VertexId, W>* edge, W weight);
+    // Write access to a live edge for anything but its weight, which goes through reweight
+    Edge<VertexId, W>* edit(const Edge<VertexId, W>* edge) noexcept;
+
+    void reserve(size_t edge_count);
+    void clear();
+
+    size_t size() const noexcept;
+    size_t chunk_count() const noexcept;
+
+    size_t negative_weight_count() const noexcept { return negative_count_; }
+    // Upper bound on the live weights: removals don't lower it, clear() does
+    W max_weight() const noexcept { return max_weight_; }
+};
+
+
+#include "../src/edge_arena.tpp"
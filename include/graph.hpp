@@ -2,28 +2,83 @@
 #include <cstddef>
 #include <nlohmann/json_fwd.hpp>
 #include "../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include "../dependencies/Data_Structures/SmartPtrs/include/SharedPtr.hpp"
 #include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <tuple>
+#include <vector>
 #include "../dependencies/json/include/nlohmann/json.hpp"
 #include "edge.hpp"
+#include "edge_arena.hpp"
 #include "vertex.hpp"
+#include "csr_graph.hpp"
+#include "results.hpp"
+#include "json_stream.hpp"
+#include "workspace.hpp"
+#include "disjoint_sets.hpp"
+#include "dynamic_connectivity.hpp"
+#include "lca_index.hpp"
+#include "heavy_light.hpp"
 
 using json = nlohmann::json;
 
 template <typename VertexId, typename Resource, typename WeightType>
 class Graph {
+  public:
+
+    // Edges are owned by the graph's arena; both directions of an edge share one handle.
+    // Handles are read-only, weights change through set_edge_weight so the arena's counters stay current
+    using EdgeHandle = const Edge<VertexId, WeightType>*;
+    using AdjacencyList = HashTable<VertexId, HashTable<VertexId, EdgeHandle>>;
+    using Workspace = AlgorithmWorkspace<VertexId, WeightType>;
+
   private:
 
     HashTable<VertexId, Vertex<VertexId, Resource>> vertex_pool_;
 
-    HashTable<VertexId, HashTable<VertexId, SharedPtr<Edge<VertexId, WeightType>>>> adjacency_list_;
+    EdgeArena<VertexId, WeightType> edge_arena_;
+
+    AdjacencyList adjacency_list_;
 
     size_t vertex_count_;
 
+    // Dense slot of every vertex; slots stay contiguous under removal by moving the last vertex into the hole
+    HashTable<VertexId, uint32_t> slots_;
+
+    std::vector<VertexId> slot_ids_;
+
     json log_json_;
+
+    // Components by slot. Insertions keep them current while tracking is on; everything else only
+    // marks them stale, and the next connectivity query rebuilds them
+    DisjointSets component_sets_;
+
+    bool track_components_ = false;
+
+    bool component_sets_stale_ = true;
+
+    // Optional index kept in step with every mutation, removals included
+    std::unique_ptr<DynamicConnectivity<VertexId>> connectivity_;
     
     void resize(size_t new_size);
 
+    void link_vertices(VertexId from, VertexId to, WeightType weight);
+    void copy_edges(const Graph& other);
+    void assign_csr(const CsrGraph<VertexId, WeightType>& csr);
+    void refresh_component_sets();
+    void rebuild_connectivity();
+    TraversalResult<VertexId> collect_traversal(VertexId start, const Workspace& workspace) const;
+    void store_traversal(const TraversalResult<VertexId>& result);
+    MatchingResult<VertexId> matching_ids(const CsrGraph<VertexId, WeightType>& csr, const CsrMatching& matching) const;
+    template <typename DistanceType>
+    DistanceTableResult<VertexId, DistanceType> distance_table_ids(std::span<const VertexId> sources,
+                                                                   DistanceMatrix<DistanceType>&& matrix) const;
+    SpanningForestResult<VertexId, WeightType> spanning_forest_ids(const CsrGraph<VertexId, WeightType>& csr,
+                                                                   const CsrSpanningForest<WeightType>& forest) const;
+
   public:
 
     Graph(const Graph& other);
@@ -35,6 +90,12 @@ class Graph {
     ~Graph() = default;
 
     void initialize_graph(size_t n);
+    void reserve_vertices(size_t vertex_count);
+    void reserve_edges(size_t edge_count);
+
+    // Bulk loading through a parallel CSR build; duplicate edges are dropped, the first one wins
+    static Graph from_edge_list(std::span<const std::tuple<VertexId, VertexId, WeightType>> edges,
+                                size_t thread_count = 0);
 
     void add_edge(VertexId from, VertexId to, WeightType weight);
     void add_vertex(VertexId id);
@@ -45,15 +106,20 @@ class Graph {
     void reset_parameters();
 
     json to_json();
+    void write_json(std::ostream& out) const;
     void save_to_json(const std::string& filename);
     void load_from_json(const std::string& filename);
+    // Binary CSR file that CsrGraph::map_binary can use without parsing; vertex data is kept
+    // when Resource is trivially copyable
+    void save_to_binary(const std::string& filename) const;
+    void load_from_binary(const std::string& filename);
     void save_json_to_file(const std::string& filename, const json& data);
 
     bool operator==(const Graph& other) const;
     bool operator!=(const Graph& other) const;
 
     size_t get_degree(const VertexId& vertex) const;
-    const HashTable<VertexId, HashTable<VertexId, SharedPtr<Edge<VertexId, WeightType>>>>& get_adjacency_list() const; 
+    const AdjacencyList& get_adjacency_list() const; 
     bool is_connected(const VertexId& from, const VertexId& to) const;
     void set_edge_weight(const VertexId& from, const VertexId& to, const WeightType& weight);
     const Vertex<VertexId, Resource>& get_vertex(const VertexId& id) const;
@@ -62,6 +128,11 @@ class Graph {
     const HashTable<VertexId, Vertex<VertexId, Resource>>& get_vertices() const;
     const json get_json() const;
 
+    uint32_t get_slot(const VertexId& id) const;
+    const VertexId& get_slot_id(uint32_t slot) const;
+
+    CsrGraph<VertexId, WeightType> freeze() const;
+
     bool has_vertex(const VertexId& vertex) const;
     bool has_edge(const VertexId& from, const VertexId& to) const;
     size_t vertex_count() const noexcept;
@@ -70,39 +141,101 @@ class Graph {
     
     void clear();
 
-    auto begin() noexcept { return adjacency_list_.begin(); }
-    auto end() noexcept { return adjacency_list_.end(); }
+    auto begin() const noexcept { return adjacency_list_.cbegin(); }
+    auto end() const noexcept { return adjacency_list_.cend(); }
     auto cbegin() const noexcept { return adjacency_list_.cbegin(); }
     auto cend() const noexcept { return adjacency_list_.cend(); }
 
 // Algorithms
 
+    // The overloads taking a Workspace are const and re-entrant: their state lives in the workspace and
+    // the vertices are left untouched, so threads can share one graph with a workspace each.
+    // The other overloads also record colors and times in the vertices
+
     // Graph traversal
-    void depth_first_search(VertexId start); // DONE
-    void breadth_first_search(VertexId start); // DONE
+    TraversalResult<VertexId> depth_first_search(VertexId start); // DONE
+    TraversalResult<VertexId> depth_first_search(VertexId start, Workspace& workspace) const;
+    TraversalResult<VertexId> breadth_first_search(VertexId start); // DONE
+    TraversalResult<VertexId> breadth_first_search(VertexId start, Workspace& workspace) const;
 
     // Connectivity
-    DynamicArray<DynamicArray<VertexId>> find_connected_components(); // DONE 
+    DynamicArray<DynamicArray<VertexId>> find_connected_components() const; // DONE 
+    DynamicArray<DynamicArray<VertexId>> find_connected_components(Workspace& workspace) const;
+
+    // With tracking on, add_vertex/add_edge update a union-find in near O(1), so these queries are near O(1).
+    // Removals can't be undone in a union-find: remove_edge/remove_vertex (and bulk loads) mark it stale and
+    // the next query rebuilds it in O(V + E). With tracking off every mutation marks it stale
+    void track_components(bool enabled = true);
+    bool same_component(const VertexId& u, const VertexId& v);
+    size_t component_count();
+    size_t component_size(const VertexId& vertex);
+
+    // Fully dynamic alternative: every mutation updates the index in amortized O(log^2 V) and queries
+    // never rebuild. same_component and component_count use it while it is enabled
+    void enable_dynamic_connectivity();
+    void disable_dynamic_connectivity();
+    bool has_dynamic_connectivity() const noexcept { return connectivity_ != nullptr; }
+
+    // Also sets Edge::is_bridge on every edge
+    BiconnectivityResult<VertexId> find_biconnected_components();
 
     // Colors
-    void greedy_coloring(VertexId start);
-    void welsh_powell_coloring();
+    ColoringResult<VertexId> greedy_coloring(VertexId start);
+    ColoringResult<VertexId> greedy_coloring(VertexId start, Workspace& workspace) const;
+    ColoringResult<VertexId> welsh_powell_coloring(); // start is the vertex colored first
 
     // Shortest paths
-    void dijkstra(VertexId start); // DONE
-    void shortest_paths_unweighted(VertexId start); // DONE
+    // Queue is one of the policies from priority_queues.hpp, e.g. dijkstra<RadixHeap>(start)
+    template <template <typename> class Queue = LazyPriorityQueue>
+    ShortestPathsResult<VertexId, WeightType> dijkstra(VertexId start); // DONE
+    template <template <typename> class Queue = LazyPriorityQueue>
+    ShortestPathsResult<VertexId, WeightType> dijkstra(VertexId start, Workspace& workspace) const;
+    ShortestPathsResult<VertexId, size_t> shortest_paths_unweighted(VertexId start); // DONE
+    ShortestPathsResult<VertexId, size_t> shortest_paths_unweighted(VertexId start, Workspace& workspace) const;
+
+    // All distances from many sources of the frozen graph at once, see CsrGraph::distance_matrix;
+    // replaces looping dijkstra / shortest_paths_unweighted over the sources
+    DistanceTableResult<VertexId, WeightType> distance_matrix(std::span<const VertexId> sources,
+                                                              size_t thread_count = 0) const;
+    DistanceTableResult<VertexId, uint32_t> unweighted_distance_matrix(std::span<const VertexId> sources,
+                                                                      size_t thread_count = 0) const;
+
+    // Single pair queries that stop once the target is settled: bidirectional Dijkstra, and A* with
+    // heuristic(vertex) estimating the remaining distance to target (must be consistent).
+    // With workspaces (one per search direction) a query costs O(touched) instead of O(V)
+    PathResult<VertexId, WeightType> shortest_path(VertexId source, VertexId target) const;
+    PathResult<VertexId, WeightType> shortest_path(VertexId source, VertexId target, Workspace& forward,
+                                                   Workspace& backward) const;
+    template <typename Heuristic>
+    PathResult<VertexId, WeightType> shortest_path(VertexId source, VertexId target, Heuristic heuristic) const;
+    template <typename Heuristic>
+    PathResult<VertexId, WeightType> shortest_path(VertexId source, VertexId target, Heuristic heuristic,
+                                                   Workspace& workspace) const;
+
+    // Export of results into files/ for the visualization scripts
+    void export_bfs(const TraversalResult<VertexId>& result);
+    void export_dfs(const TraversalResult<VertexId>& result);
+    void export_components(const DynamicArray<DynamicArray<VertexId>>& components);
+    void export_greedy_coloring(const ColoringResult<VertexId>& result);
+    void export_dijkstra(const ShortestPathsResult<VertexId, WeightType>& result);
+    void export_shortest_paths_unweighted(const ShortestPathsResult<VertexId, size_t>& result);
 
-    // Matchings
-    void kuhn_max_matching();
-    void edmonds_max_matching();
-    void hopcroft_karp();
+    // Matchings of the frozen graph; kuhn and hopcroft_karp throw std::runtime_error on a non-bipartite graph
+    MatchingResult<VertexId> kuhn_max_matching() const;
+    MatchingResult<VertexId> edmonds_max_matching() const;
+    MatchingResult<VertexId> hopcroft_karp() const;
 
     // Trees
-    void kruskal();
-    void prim();
-    void boruvka();
-    void lca(VertexId u, VertexId v);
-    void heavy_light_decomposition();
+    // Minimum spanning forests of the frozen graph, see CsrGraph for the edge order
+    SpanningForestResult<VertexId, WeightType> kruskal(size_t thread_count = 0) const;
+    SpanningForestResult<VertexId, WeightType> prim() const;
+    SpanningForestResult<VertexId, WeightType> boruvka(size_t thread_count = 0) const;
+    // Reusable LCA index over the frozen forest, see LcaIndex::build for the roots
+    LcaIndex<VertexId> lca_index() const;
+    LcaIndex<VertexId> lca_index(const VertexId& root) const;
+    // Path sums and maxima of edge weights in O(log^2 n), see HeavyLightDecomposition
+    HeavyLightDecomposition<VertexId, WeightType> heavy_light_decomposition() const;
+    HeavyLightDecomposition<VertexId, WeightType> heavy_light_decomposition(const VertexId& root) const;
 
     // Graph Generators
     void generate_complete_graph(size_t n);
@@ -122,7 +255,15 @@ class Graph {
 #include "../src/algorithms/dfs.tpp"
 #include "../src/algorithms/bfs.tpp"
 #include "../src/algorithms/components.tpp"
+#include "../src/algorithms/biconnectivity.tpp"
 #include "../src/generators.tpp"
 #include "../src/algorithms/dijkstra.tpp"
+#include "../src/algorithms/delta_stepping.tpp"
+#include "../src/algorithms/point_to_point.tpp"
+#include "../src/algorithms/distance_matrix.tpp"
 #include "../src/algorithms/shortest_paths_unweighted.tpp"
 #include "../src/algorithms/coloring.tpp"
+#include "../src/algorithms/spanning_forest.tpp"
+#include "../src/algorithms/matching.tpp"
+#include "../src/algorithms/lca.tpp"
+#include "../src/algorithms/heavy_light.tpp"
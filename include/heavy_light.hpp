@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+
+// Heavy-light decomposition of a weighted forest. Vertices are numbered in a DFS order that takes the
+// heavy child (largest subtree) first, so every heavy chain and every subtree is a contiguous range,
+// and a path crosses O(log n) chains. The weight of an edge sits at its child's position in a bottom-up
+// segment tree of sums and maxima: path queries and weight updates take O(log^2 n) and O(log n)
+template <typename VertexId, typename WeightType>
+class HeavyLightDecomposition {
+  private:
+
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+    static constexpr WeightType lowest = std::numeric_limits<WeightType>::lowest();
+
+    std::vector<VertexId> vertex_ids_;
+
+    HashTable<VertexId, uint32_t> index_;
+
+    std::vector<uint32_t> parents_; // a root is its own parent
+
+    std::vector<uint32_t> depths_;
+
+    std::vector<uint32_t> roots_;
+
+    std::vector<uint32_t> heads_;     // top vertex of the heavy chain
+
+    std::vector<uint32_t> positions_; // position in the decomposition order
+
+    // Node i has children 2i and 2i + 1, leaf of position p is node n + p
+    std::vector<WeightType> sums_;
+    std::vector<WeightType> maxima_;
+
+    static HeavyLightDecomposition build_from(const CsrGraph<VertexId, WeightType>& forest, uint32_t first_root);
+
+    uint32_t index_of(const VertexId& id) const;
+    uint32_t child_of_edge(const VertexId& u, const VertexId& v) const;
+    void update(uint32_t position, WeightType weight);
+    // Sum and max over positions [first, last]
+    std::pair<WeightType, WeightType> range(uint32_t first, uint32_t last) const;
+    std::optional<std::pair<WeightType, WeightType>> path(const VertexId& u, const VertexId& v) const;
+
+  public:
+
+    HeavyLightDecomposition() = default;
+
+    // Throws std::runtime_error if the graph has a cycle. Every tree is rooted at its smallest index,
+    // except the one containing root; edge weights come from the graph
+    static HeavyLightDecomposition build(const CsrGraph<VertexId, WeightType>& forest);
+    static HeavyLightDecomposition build(const CsrGraph<VertexId, WeightType>& forest, const VertexId& root);
+
+    // Over the edges of the tree path, nullopt if u and v are in different trees.
+    // An empty path (u == v) has sum 0 and max numeric_limits::lowest()
+    std::optional<WeightType> path_sum(const VertexId& u, const VertexId& v) const;
+    std::optional<WeightType> path_max(const VertexId& u, const VertexId& v) const;
+
+    // Throws std::invalid_argument if u-v is not a tree edge
+    WeightType edge_weight(const VertexId& u, const VertexId& v) const;
+    void set_edge_weight(const VertexId& u, const VertexId& v, WeightType weight);
+
+    VertexId head(const VertexId& vertex) const { return vertex_ids_[heads_[index_of(vertex)]]; }
+    size_t depth(const VertexId& vertex) const { return depths_[index_of(vertex)]; }
+    size_t vertex_count() const noexcept { return vertex_ids_.size(); }
+};
+
+
+#include "../src/heavy_light.tpp"
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include "../dependencies/json/include/nlohmann/json.hpp"
+
+// SAX handler that inserts vertices and edges into a graph while the document is parsed,
+// so no DOM of the file is ever built. Understands the layout written by Graph::write_json:
+// {"vertex_count": n, "edges": [{"from", "to", "weight"}...], "vertices": [{"id"}...]}
+// Keys may come in any order, but vertex_count only pre-sizes the graph when it comes first.
+// vertex_count is only a hint: it is capped by the number of vertex entries input_size bytes can hold
+template <typename GraphType, typename VertexId, typename WeightType>
+class GraphJsonSax : public nlohmann::json_sax<nlohmann::json> {
+  private:
+
+    using json = nlohmann::json;
+
+    enum class Section { none, vertices, edges, other };
+
+    GraphType& graph_;
+
+    // Smallest vertex entry is {"id":0}
+    static constexpr size_t min_vertex_entry_size = 8;
+
+    size_t reserve_limit_;
+
+    Section section_ = Section::none;
+
+    size_t depth_ = 0;
+
+    std::string key_;
+
+    std::optional<VertexId> id_;
+    std::optional<VertexId> from_;
+    std::optional<VertexId> to_;
+    std::optional<WeightType> weight_;
+
+    // Endpoints created by an edge before their vertex entry came up; that entry may still follow once
+    std::unordered_set<VertexId> implicit_vertices_;
+
+    void ensure_vertex(const VertexId& id);
+    void add_vertex_entry(const VertexId& id);
+    bool scalar(json value);
+
+  public:
+
+    GraphJsonSax(GraphType& graph, size_t input_size) :
+        graph_(graph), reserve_limit_(input_size / min_vertex_entry_size) {}
+
+    bool null() override;
+    bool boolean(bool value) override;
+    bool number_integer(number_integer_t value) override;
+    bool number_unsigned(number_unsigned_t value) override;
+    bool number_float(number_float_t value, const string_t& text) override;
+    bool string(string_t& value) override;
+    bool binary(binary_t& value) override;
+
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& value) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+
+    bool parse_error(std::size_t position, const std::string& token,
+                     const nlohmann::detail::exception& error) override;
+};
+
+
+#include "../src/json_stream.tpp"
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+#include "disjoint_sets.hpp"
+
+// Lowest common ancestors in a rooted forest. The LCA of u and v is the shallowest vertex of the Euler
+// tour between their first occurrences, so a sparse table over the tour answers queries in O(1) after
+// O(n log n) preprocessing. Binary lifting tables give k-th ancestors in O(log n)
+template <typename VertexId>
+class LcaIndex {
+  private:
+
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    std::vector<VertexId> vertex_ids_;
+
+    HashTable<VertexId, uint32_t> index_;
+
+    std::vector<uint32_t> parents_; // a root is its own parent
+
+    std::vector<uint32_t> depths_;
+
+    std::vector<uint32_t> roots_;
+
+    std::vector<uint32_t> euler_;
+
+    std::vector<uint32_t> first_; // first and last position of every vertex in the tour
+    std::vector<uint32_t> last_;
+
+    // Levels stored back to back: sparse_[k * tour size + i] is the shallowest vertex in euler_[i, i + 2^k),
+    // up_[k * n + v] the 2^k-th ancestor of v (roots stay put)
+    std::vector<uint32_t> sparse_;
+    std::vector<uint32_t> up_;
+
+    template <typename WeightType>
+    static LcaIndex build_from(const CsrGraph<VertexId, WeightType>& forest, uint32_t first_root);
+
+    uint32_t index_of(const VertexId& id) const;
+    uint32_t shallower(uint32_t a, uint32_t b) const { return depths_[a] <= depths_[b] ? a : b; }
+    uint32_t lca_index(uint32_t u, uint32_t v) const;
+
+  public:
+
+    LcaIndex() = default;
+
+    // Throws std::runtime_error if the graph has a cycle. Every tree is rooted at its smallest index,
+    // except the one containing root
+    template <typename WeightType>
+    static LcaIndex build(const CsrGraph<VertexId, WeightType>& forest);
+    template <typename WeightType>
+    static LcaIndex build(const CsrGraph<VertexId, WeightType>& forest, const VertexId& root);
+
+    // nullopt if u and v are in different trees
+    std::optional<VertexId> lca(const VertexId& u, const VertexId& v) const;
+
+    // Offline Tarjan over the stored tour: one pass with a union-find, O(n + queries)
+    std::vector<std::optional<VertexId>> lca(std::span<const std::pair<VertexId, VertexId>> queries) const;
+
+    // nullopt if vertex is less than k levels deep
+    std::optional<VertexId> ancestor(const VertexId& vertex, size_t k) const;
+
+    // Edges on the tree path, nullopt if u and v are in different trees
+    std::optional<size_t> distance(const VertexId& u, const VertexId& v) const;
+
+    VertexId parent(const VertexId& vertex) const { return vertex_ids_[parents_[index_of(vertex)]]; }
+    VertexId root(const VertexId& vertex) const { return vertex_ids_[roots_[index_of(vertex)]]; }
+    size_t depth(const VertexId& vertex) const { return depths_[index_of(vertex)]; }
+    size_t vertex_count() const noexcept { return vertex_ids_.size(); }
+};
+
+
+#include "../src/lca_index.tpp"
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Layout of the binary graph file: the header is followed by 64-byte aligned sections
+// offsets | neighbors | weights | vertex ids | payload flags | payloads
+struct GraphFileHeader {
+    static constexpr char magic_value[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+    static constexpr uint32_t current_version = 1;
+    static constexpr uint32_t byte_order_mark = 0x01020304;
+    static constexpr size_t alignment = 64;
+
+    static constexpr uint32_t sorted_ids = 1u << 0;
+    static constexpr uint32_t has_payloads = 1u << 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t flags;
+    uint32_t offset_size;
+    uint32_t id_size;
+    uint32_t weight_size;
+    uint64_t payload_size;
+    uint64_t vertex_count;
+    uint64_t entry_count; // two entries per undirected edge
+
+    uint64_t offsets_position;
+    uint64_t neighbors_position;
+    uint64_t weights_position;
+    uint64_t ids_position;
+    uint64_t payload_flags_position;
+    uint64_t payloads_position;
+};
+
+
+// Read-only private mapping of a whole file; unmapped on destruction
+class MappedFile {
+  private:
+
+    const std::byte* data_ = nullptr;
+
+    size_t size_ = 0;
+
+  public:
+
+    explicit MappedFile(const std::string& filename);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    const std::byte* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+};
+
+
+#include "../src/mapped_file.tpp"
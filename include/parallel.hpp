@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Number of workers used when a caller passes thread_count == 0
+inline size_t default_thread_count();
+
+// Splits [0, count) into one contiguous range per worker and calls function(begin, end, worker)
+template <typename Function>
+void parallel_for(size_t count, size_t thread_count, Function&& function);
+
+// Sorts chunks in parallel and merges them pairwise
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T>& data, Compare compare, size_t thread_count);
+
+
+#include "../src/parallel.tpp"
@@ -0,0 +1,141 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../dependencies/Data_Structures/Containers/Pair.hpp"
+#include "../dependencies/Data_Structures/Containers/Priority_Queue.hpp"
+
+// Queue policies for Dijkstra. Every policy is built as Queue<WeightType>(vertex_count, max_weight) and offers
+//   push(vertex, distance) - insert, or lower the key of a queued vertex
+//   pop()                  - remove and return {distance, vertex} with the smallest distance
+//   empty()
+//   reset(vertex_count, max_weight) - empty the queue for the next run, reusing its buffers
+// Lazy policies keep outdated entries around, Dijkstra skips them when they come up
+
+
+// The dependency PriorityQueue with duplicate entries; keeps the original Graph::dijkstra ordering
+template <typename WeightType>
+class LazyPriorityQueue {
+  private:
+    PriorityQueue<Pair<WeightType, uint32_t>> queue_;
+
+  public:
+    LazyPriorityQueue(size_t, WeightType) {}
+
+    bool empty() const { return queue_.empty(); }
+    void reset(size_t, WeightType);
+    void push(uint32_t vertex, WeightType distance);
+    std::pair<WeightType, uint32_t> pop();
+};
+
+
+// std::priority_queue min-heap with duplicate entries
+template <typename WeightType>
+class BinaryHeap {
+  private:
+    using Entry = std::pair<WeightType, uint32_t>;
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue_;
+
+  public:
+    BinaryHeap(size_t, WeightType) {}
+
+    bool empty() const { return queue_.empty(); }
+    void reset(size_t, WeightType);
+    void push(uint32_t vertex, WeightType distance) { queue_.push({distance, vertex}); }
+    const std::pair<WeightType, uint32_t>& top() const { return queue_.top(); }
+    std::pair<WeightType, uint32_t> pop();
+};
+
+
+// d-ary heap with a position index per vertex, so decrease-key never leaves stale entries
+template <typename WeightType, size_t Arity>
+class IndexedDaryHeap {
+  private:
+    static constexpr uint32_t absent = std::numeric_limits<uint32_t>::max();
+
+    std::vector<std::pair<WeightType, uint32_t>> heap_;
+
+    std::vector<uint32_t> position_;
+
+    void sift_up(size_t index);
+    void sift_down(size_t index);
+    void place(size_t index, std::pair<WeightType, uint32_t> entry);
+
+  public:
+    IndexedDaryHeap(size_t vertex_count, WeightType);
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+    bool contains(uint32_t vertex) const { return position_[vertex] != absent; }
+    // Only the entries still queued are unindexed, so after a full run this is O(1)
+    void reset(size_t vertex_count, WeightType);
+    void push(uint32_t vertex, WeightType distance);
+    std::pair<WeightType, uint32_t> pop();
+};
+
+template <typename WeightType>
+using IndexedFourAryHeap = IndexedDaryHeap<WeightType, 4>;
+
+
+// Monotone radix heap for integer weights: popped keys never decrease, so entries are kept in
+// buckets by the highest bit in which they differ from the last popped key
+template <typename WeightType>
+class RadixHeap {
+    static_assert(std::is_integral_v<WeightType>, "RadixHeap needs integer weights");
+
+  private:
+    using Key = std::make_unsigned_t<WeightType>;
+
+    static constexpr size_t bucket_count = std::numeric_limits<Key>::digits + 1;
+
+    std::array<std::vector<std::pair<Key, uint32_t>>, bucket_count> buckets_;
+
+    Key last_ = 0;
+
+    size_t size_ = 0;
+
+    static size_t bucket_of(Key key, Key last);
+
+  public:
+    RadixHeap(size_t, WeightType) {}
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    void reset(size_t, WeightType);
+    void push(uint32_t vertex, WeightType distance);
+    std::pair<WeightType, uint32_t> pop();
+};
+
+
+// Dial's algorithm: a ring of max_weight + 1 buckets, one per pending distance value.
+// Only worth it for small integer weights, memory grows with max_weight
+template <typename WeightType>
+class DialBuckets {
+    static_assert(std::is_integral_v<WeightType>, "DialBuckets needs integer weights");
+
+  private:
+    std::vector<std::vector<uint32_t>> buckets_;
+
+    WeightType current_ = 0;
+
+    size_t size_ = 0;
+
+  public:
+    DialBuckets(size_t, WeightType max_weight);
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    // Keeps the ring while max_weight is unchanged; an empty ring needs no clearing
+    void reset(size_t, WeightType max_weight);
+    void push(uint32_t vertex, WeightType distance);
+    std::pair<WeightType, uint32_t> pop();
+};
+
+
+#include "../src/priority_queues.tpp"
@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
+#include "vertex.hpp"
+#include "csr_graph.hpp"
+
+// Plain results of Graph algorithms; only vertices reached from the start appear in the tables
+
+template <typename VertexId>
+struct TraversalResult {
+    VertexId start;
+    DynamicArray<VertexId> order; // discovery order
+    HashTable<VertexId, int> discovery_time;
+    HashTable<VertexId, int> finish_time;
+
+    bool reached(const VertexId& vertex) const {
+        return discovery_time.find(vertex) != discovery_time.end();
+    }
+};
+
+
+template <typename VertexId, typename DistanceType>
+struct ShortestPathsResult {
+    VertexId start;
+    HashTable<VertexId, DistanceType> distances;
+    HashTable<VertexId, VertexId> previous; // start is its own predecessor
+
+    bool reached(const VertexId& vertex) const {
+        return distances.find(vertex) != distances.end();
+    }
+
+    // Empty if target is unreachable
+    DynamicArray<VertexId> path_to(const VertexId& target) const {
+        DynamicArray<VertexId> path;
+        if (!reached(target)) {
+            return path;
+        }
+
+        std::vector<VertexId> reversed;
+        for (VertexId current = target; current != start; current = previous.at(current)) {
+            reversed.push_back(current);
+        }
+        reversed.push_back(start);
+
+        for (auto it = reversed.rbegin(); it != reversed.rend(); ++it) {
+            path.push_back(*it);
+        }
+        return path;
+    }
+};
+
+
+template <typename VertexId>
+struct ColoringResult {
+    VertexId start;
+    size_t color_count = 0;
+    HashTable<VertexId, size_t> colors;
+};
+
+
+template <typename VertexId>
+struct BiconnectivityResult {
+    DynamicArray<std::pair<VertexId, VertexId>> bridges;
+    DynamicArray<VertexId> articulation_points;
+    DynamicArray<DynamicArray<VertexId>> two_edge_components;
+    DynamicArray<DynamicArray<VertexId>> blocks; // vertices of every biconnected component
+};
+
+
+template <typename VertexId>
+struct MatchingResult {
+    DynamicArray<std::pair<VertexId, VertexId>> pairs; // every matched pair once
+};
+
+
+template <typename VertexId, typename WeightType>
+struct SpanningForestResult {
+    WeightType total_weight = 0;
+    DynamicArray<std::tuple<VertexId, VertexId, WeightType>> edges;
+};
+
+
+template <typename VertexId, typename WeightType>
+struct PathResult {
+    WeightType distance = 0;
+    DynamicArray<VertexId> path; // empty if target is unreachable
+    size_t settled = 0;          // vertices settled before the search stopped
+
+    bool found() const {
+        return !path.empty();
+    }
+};
+
+
+// Batched distances from several sources. Rows follow the requested sources, columns are the vertex slots
+template <typename VertexId, typename DistanceType>
+struct DistanceTableResult {
+    DynamicArray<VertexId> sources;
+    DynamicArray<VertexId> vertices; // vertex of every column
+    DistanceMatrix<DistanceType> matrix;
+
+    // Same table as ShortestPathsResult::distances for that source
+    HashTable<VertexId, DistanceType> distances(size_t source_row) const {
+        HashTable<VertexId, DistanceType> table;
+        auto row = matrix.row(source_row);
+        for (size_t column = 0; column < row.size(); ++column) {
+            if (row[column] != std::numeric_limits<DistanceType>::max()) {
+                table[vertices[column]] = row[column];
+            }
+        }
+        return table;
+    }
+};
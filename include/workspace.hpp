@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "edge.hpp"
+#include "vertex.hpp"
+
+template <typename VertexId, typename Resource, typename WeightType>
+class Graph;
+
+// Scratch state of the const Graph algorithms, indexed by vertex slot.
+// The algorithms never write into the vertices, so one graph can serve any number of
+// query threads as long as every thread passes its own workspace.
+// Buffers are sized once per graph; a slot's entries only count when its stamp matches the current
+// epoch, so starting a query costs O(1) and the work is proportional to the vertices it touches
+template <typename VertexId, typename WeightType>
+class AlgorithmWorkspace {
+  private:
+    template <typename, typename, typename>
+    friend class Graph;
+
+    using EdgeIterator = typename HashTable<VertexId, const Edge<VertexId, WeightType>*>::const_iterator;
+
+    size_t slot_count_ = 0;
+
+    uint32_t epoch_ = 0;
+
+    std::vector<uint32_t> stamps_;
+
+    std::vector<int> discovery_times_;
+    std::vector<int> finish_times_;
+
+    std::vector<WeightType> distances_;
+    std::vector<uint32_t> previous_;
+    std::vector<uint8_t> states_; // 0 -> white, 1 -> gray, 2 -> black
+
+    std::vector<size_t> colors_;
+    std::vector<uint64_t> palette_; // one bit per color
+    std::vector<size_t> degrees_;
+
+    std::vector<uint32_t> order_;
+    std::vector<uint32_t> stack_;
+    std::vector<std::pair<EdgeIterator, EdgeIterator>> cursors_;
+
+    // Priority queue of the last weighted search, kept so the next search with the same policy
+    // reuses its buffers instead of allocating O(V) or O(max_weight) again
+    std::unique_ptr<void, void (*)(void*)> queue_{nullptr, nullptr};
+    const std::type_info* queue_type_ = nullptr;
+
+    // Starts a query on a graph with slot_count slots; reallocates only when the size changes
+    void begin(size_t slot_count);
+
+    bool touched(uint32_t slot) const noexcept { return stamps_[slot] == epoch_; }
+
+    // First touch in this epoch resets the slot's entries
+    void touch(uint32_t slot);
+
+    // Empty queue of the given policy, see priority_queues.hpp
+    template <typename Queue>
+    Queue& queue(size_t vertex_count, WeightType max_weight);
+
+  public:
+    AlgorithmWorkspace() = default;
+    explicit AlgorithmWorkspace(size_t slot_count);
+
+    size_t slot_count() const noexcept { return slot_count_; }
+};
+
+
+#include "../src/workspace.tpp"
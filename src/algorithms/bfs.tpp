@@ -1,12 +1,27 @@
 #include "../../include/graph.hpp"
-#include "../../dependencies/Data_Structures/Containers/Queue.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include <fstream>
-#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 template <typename VertexType, typename Resource, typename WeightType>
-void Graph<VertexType, Resource, WeightType>::breadth_first_search(VertexType start) {
+TraversalResult<VertexType> Graph<VertexType, Resource, WeightType>::breadth_first_search(VertexType start) {
+    Workspace workspace;
+    TraversalResult<VertexType> result = std::as_const(*this).breadth_first_search(start, workspace);
+
+    reset_parameters();
+    store_traversal(result);
+    return result;
+}
+
+
+template <typename VertexType, typename Resource, typename WeightType>
+TraversalResult<VertexType> Graph<VertexType, Resource, WeightType>::breadth_first_search(VertexType start,
+                                                                                          Workspace& workspace) const {
     // Check if graph is empty
     if (vertex_pool_.empty()) {
         throw std::runtime_error("Cannot perform BFS on empty graph");
@@ -17,36 +32,220 @@ void Graph<VertexType, Resource, WeightType>::breadth_first_search(VertexType st
         throw std::runtime_error("Start vertex does not exist in graph");
     }
 
-    reset_parameters();
+    // Traversal state lives in flat arrays indexed by slot; edges carry their endpoint slots
+    // A slot is white until the workspace has touched it in this query
+    workspace.begin(slot_ids_.size());
+    auto& discovery_times = workspace.discovery_times_;
+    auto& finish_times = workspace.finish_times_;
+
+    // Discovery order doubles as the queue
+    auto& order = workspace.order_;
+    size_t timer = 0;
+
+    uint32_t source = slots_.at(start);
+    workspace.touch(source);
+    order.push_back(source);
+    discovery_times[source] = timer++;
+
+    for (size_t head = 0; head < order.size(); ++head) {
+        uint32_t current = order[head];
+
+        // Check all neighbors of current vertex
+        auto adj_it = adjacency_list_.find(slot_ids_[current]);
+        if (adj_it != adjacency_list_.end()) {
+            for (const auto& [_, edge_ptr] : adj_it->second) {
+                uint32_t neighbor = edge_ptr->opposite_slot(current);
+                if (!workspace.touched(neighbor)) { // White vertex
+                    workspace.touch(neighbor);
+                    order.push_back(neighbor);
+                    discovery_times[neighbor] = timer++;
+                }
+            }
+        }
+
+        // Finish current vertex
+        finish_times[current] = timer++;
+    }
+
+    return collect_traversal(start, workspace);
+}
 
-    // Create parameters for logging
+
+template <typename VertexType, typename Resource, typename WeightType>
+void Graph<VertexType, Resource, WeightType>::export_bfs(const TraversalResult<VertexType>& result) {
     json parameters;
     parameters["vertex_count"] = vertex_pool_.size();
-    parameters["start_vertex"] = start;
+    parameters["start_vertex"] = result.start;
     save_json_to_file("bfs_parameters.json", parameters);
+}
 
-    Queue<VertexType> queue;
-    size_t timer = 0;
-    
-    queue.enqueue(start);
-    vertex_pool_[start].set_color(1); // Gray
-    vertex_pool_[start].set_discovery_time(timer++);
 
-    while (!queue.empty()) {
-        VertexType current = queue.front();
-        queue.dequeue();
+template <typename VertexId, typename WeightType>
+CsrTraversal CsrGraph<VertexId, WeightType>::breadth_first_search(VertexId start) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform BFS on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex does not exist in graph");
+    }
 
-        // Check all neighbors of current vertex
-        for (const auto& [neighbor, edge] : adjacency_list_[current]) {
-            if (vertex_pool_[neighbor].get_color() == 0) { // White vertex
-                queue.enqueue(neighbor);
-                vertex_pool_[neighbor].set_color(1); // Gray
-                vertex_pool_[neighbor].set_discovery_time(timer++);
+    CsrTraversal result;
+    result.discovery_time.assign(vertex_count(), -1);
+    result.finish_time.assign(vertex_count(), -1);
+    result.order.reserve(vertex_count());
+
+    // The order array doubles as the queue
+    int timer = 0;
+    uint32_t source = index_of(start);
+    result.order.push_back(source);
+    result.discovery_time[source] = timer++;
+
+    for (size_t head = 0; head < result.order.size(); ++head) {
+        uint32_t current = result.order[head];
+
+        for (uint32_t neighbor : neighbors(current)) {
+            if (result.discovery_time[neighbor] == -1) {
+                result.order.push_back(neighbor);
+                result.discovery_time[neighbor] = timer++;
             }
         }
 
-        // Finish current vertex
-        vertex_pool_[current].set_color(2); // Black
-        vertex_pool_[current].set_finish_time(timer++);
+        result.finish_time[current] = timer++;
     }
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrBfsTree CsrGraph<VertexId, WeightType>::parallel_breadth_first_search(VertexId start, size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform BFS on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex does not exist in graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    // Switching thresholds from Beamer, Asanovic and Patterson
+    constexpr size_t alpha = 15;
+    constexpr size_t beta = 18;
+    constexpr uint32_t unvisited = std::numeric_limits<uint32_t>::max();
+
+    const size_t n = vertex_count();
+    CsrBfsTree result;
+    result.levels.assign(n, -1);
+    std::vector<uint32_t> parents(n, unvisited);
+
+    auto test_bit = [](const std::vector<uint64_t>& bits, uint32_t v) {
+        return (bits[v >> 6] >> (v & 63)) & 1;
+    };
+
+    uint32_t source = index_of(start);
+    parents[source] = source;
+    result.levels[source] = 0;
+
+    std::vector<uint32_t> frontier{source};
+    std::vector<uint64_t> frontier_bits((n + 63) / 64);
+    std::vector<uint64_t> next_bits((n + 63) / 64);
+    std::vector<std::vector<uint32_t>> local_next(thread_count);
+    std::vector<size_t> awake(thread_count);
+    std::vector<size_t> awake_edges(thread_count);
+
+    size_t frontier_size = 1;
+    size_t frontier_edges = degree(source);
+    size_t unexplored_edges = neighbors_.size() - frontier_edges;
+    bool bottom_up = false;
+    int level = 0;
+
+    while (frontier_size > 0) {
+        if (!bottom_up && frontier_edges > unexplored_edges / alpha) {
+            std::fill(frontier_bits.begin(), frontier_bits.end(), 0);
+            for (uint32_t v : frontier) {
+                frontier_bits[v >> 6] |= uint64_t(1) << (v & 63);
+            }
+            bottom_up = true;
+        } else if (bottom_up && frontier_size < n / beta) {
+            frontier.clear();
+            for (uint32_t v = 0; v < n; ++v) {
+                if (test_bit(frontier_bits, v)) {
+                    frontier.push_back(v);
+                }
+            }
+            bottom_up = false;
+        }
+
+        ++level;
+        std::fill(awake.begin(), awake.end(), 0);
+        std::fill(awake_edges.begin(), awake_edges.end(), 0);
+
+        if (bottom_up) {
+            // Every unvisited vertex looks for any parent in the frontier and stops at the first one
+            std::fill(next_bits.begin(), next_bits.end(), 0);
+            parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t worker) {
+                for (size_t v = begin; v < end; ++v) {
+                    if (parents[v] != unvisited) {
+                        continue;
+                    }
+                    for (uint32_t u : neighbors(static_cast<uint32_t>(v))) {
+                        if (test_bit(frontier_bits, u)) {
+                            parents[v] = u;
+                            result.levels[v] = level;
+                            std::atomic_ref<uint64_t>(next_bits[v >> 6])
+                                .fetch_or(uint64_t(1) << (v & 63), std::memory_order_relaxed);
+                            ++awake[worker];
+                            awake_edges[worker] += degree(static_cast<uint32_t>(v));
+                            break;
+                        }
+                    }
+                }
+            });
+            std::swap(frontier_bits, next_bits);
+        } else {
+            for (auto& next : local_next) {
+                next.clear();
+            }
+            parallel_for(frontier.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+                for (size_t i = begin; i < end; ++i) {
+                    uint32_t u = frontier[i];
+                    for (uint32_t v : neighbors(u)) {
+                        std::atomic_ref<uint32_t> parent(parents[v]);
+                        uint32_t expected = unvisited;
+                        if (parent.load(std::memory_order_relaxed) != unvisited ||
+                            !parent.compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+                            continue;
+                        }
+                        result.levels[v] = level;
+                        local_next[worker].push_back(v);
+                        awake_edges[worker] += degree(v);
+                    }
+                }
+            });
+
+            frontier.clear();
+            for (const auto& next : local_next) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+            }
+            awake[0] = frontier.size();
+        }
+
+        frontier_size = 0;
+        frontier_edges = 0;
+        for (size_t worker = 0; worker < thread_count; ++worker) {
+            frontier_size += awake[worker];
+            frontier_edges += awake_edges[worker];
+        }
+        unexplored_edges -= std::min(unexplored_edges, frontier_edges);
+    }
+
+    for (uint32_t v = 0; v < n; ++v) {
+        if (parents[v] == unvisited) {
+            parents[v] = v;
+        }
+    }
+    result.parents = std::move(parents);
+
+    return result;
 }
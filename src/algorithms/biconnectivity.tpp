@@ -0,0 +1,376 @@
+#include "../../include/graph.hpp"
+#include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+template <typename VertexId, typename WeightType>
+CsrBiconnectivity CsrGraph<VertexId, WeightType>::finish_biconnectivity(const std::vector<uint32_t>& parents,
+                                                                        const std::vector<uint32_t>& order,
+                                                                        const std::vector<uint32_t>& tree_blocks,
+                                                                        size_t thread_count) const {
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+    constexpr size_t no_position = std::numeric_limits<size_t>::max();
+
+    const size_t n = vertex_count();
+    CsrBiconnectivity result;
+    auto& edge_blocks = result.edge_blocks;
+    edge_blocks.resize(neighbors_.size());
+
+    // A tree edge is in the block of its child, a non-tree edge in the block of the tree edge above
+    // its later endpoint
+    std::vector<size_t> first(n, no_position);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            for (size_t e = offsets_[v]; e < offsets_[v + 1]; ++e) {
+                uint32_t w = neighbors_[e];
+                uint32_t child = parents[w] == v ? w : parents[v] == w ? static_cast<uint32_t>(v)
+                                                   : order[v] > order[w] ? static_cast<uint32_t>(v) : w;
+                uint32_t block = tree_blocks[child];
+                edge_blocks[e] = block;
+
+                std::atomic_ref<size_t> block_first(first[block]);
+                size_t seen = block_first.load(std::memory_order_relaxed);
+                while (e < seen && !block_first.compare_exchange_weak(seen, e, std::memory_order_relaxed)) {}
+            }
+        }
+    });
+
+    // Numbering by first position makes the labels independent of the spanning forest
+    std::vector<uint32_t> raw_blocks;
+    for (uint32_t block = 0; block < n; ++block) {
+        if (first[block] != no_position) {
+            raw_blocks.push_back(block);
+        }
+    }
+    parallel_sort(raw_blocks, [&first](uint32_t a, uint32_t b) { return first[a] < first[b]; }, thread_count);
+    result.block_count = raw_blocks.size();
+
+    std::vector<uint32_t> dense(n, none);
+    for (uint32_t i = 0; i < raw_blocks.size(); ++i) {
+        dense[raw_blocks[i]] = i;
+    }
+
+    std::vector<uint32_t> block_sizes(result.block_count, 0);
+    parallel_for(edge_blocks.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t e = begin; e < end; ++e) {
+            edge_blocks[e] = dense[edge_blocks[e]];
+            std::atomic_ref<uint32_t>(block_sizes[edge_blocks[e]]).fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    // A bridge is a block of one edge, seen from both ends; an articulation point touches two blocks
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> bridges(thread_count);
+    std::vector<std::vector<uint32_t>> articulation_points(thread_count);
+    std::vector<uint32_t> sets(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t v = begin; v < end; ++v) {
+            sets[v] = static_cast<uint32_t>(v);
+            bool separates = false;
+            for (size_t e = offsets_[v]; e < offsets_[v + 1]; ++e) {
+                separates |= edge_blocks[e] != edge_blocks[offsets_[v]];
+                if (block_sizes[edge_blocks[e]] == 2 && v < neighbors_[e]) {
+                    bridges[worker].emplace_back(static_cast<uint32_t>(v), neighbors_[e]);
+                }
+            }
+            if (separates) {
+                articulation_points[worker].push_back(static_cast<uint32_t>(v));
+            }
+        }
+    });
+    for (size_t worker = 0; worker < thread_count; ++worker) {
+        result.bridges.insert(result.bridges.end(), bridges[worker].begin(), bridges[worker].end());
+        result.articulation_points.insert(result.articulation_points.end(),
+                                          articulation_points[worker].begin(), articulation_points[worker].end());
+    }
+    std::sort(result.bridges.begin(), result.bridges.end());
+
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            for (size_t e = offsets_[v]; e < offsets_[v + 1]; ++e) {
+                if (block_sizes[edge_blocks[e]] != 2 && v < neighbors_[e]) {
+                    link_roots(sets, static_cast<uint32_t>(v), neighbors_[e]);
+                }
+            }
+        }
+    });
+    compress_roots(sets, thread_count);
+    result.two_edge_components = label_roots(sets, thread_count);
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrBiconnectivity CsrGraph<VertexId, WeightType>::biconnectivity() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find biconnected components in empty graph");
+    }
+
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    const size_t n = vertex_count();
+    std::vector<uint32_t> discovery(n, none);
+    std::vector<uint32_t> low(n);
+    std::vector<uint32_t> parents(n, none);
+    std::vector<size_t> cursors(n);
+    std::vector<uint32_t> tree_blocks(n, none);
+    std::vector<uint32_t> stack;
+    std::vector<uint32_t> pending; // children whose tree edge has no block yet
+    uint32_t time = 0;
+    uint32_t block_count = 0;
+
+    for (uint32_t root = 0; root < n; ++root) {
+        if (discovery[root] != none) {
+            continue;
+        }
+
+        parents[root] = root;
+        discovery[root] = low[root] = time++;
+        cursors[root] = offsets_[root];
+        stack.assign(1, root);
+
+        while (!stack.empty()) {
+            uint32_t current = stack.back();
+            if (cursors[current] < offsets_[current + 1]) {
+                uint32_t neighbor = neighbors_[cursors[current]++];
+                if (discovery[neighbor] == none) {
+                    parents[neighbor] = current;
+                    discovery[neighbor] = low[neighbor] = time++;
+                    cursors[neighbor] = offsets_[neighbor];
+                    stack.push_back(neighbor);
+                    pending.push_back(neighbor);
+                } else if (neighbor != parents[current]) {
+                    low[current] = std::min(low[current], discovery[neighbor]);
+                }
+                continue;
+            }
+
+            stack.pop_back();
+            if (current == root) {
+                continue;
+            }
+
+            uint32_t parent = parents[current];
+            low[parent] = std::min(low[parent], low[current]);
+
+            // Nothing below current reaches above parent, so the pending tree edges from current down form a block
+            if (low[current] >= discovery[parent]) {
+                uint32_t member;
+                do {
+                    member = pending.back();
+                    pending.pop_back();
+                    tree_blocks[member] = block_count;
+                } while (member != current);
+                ++block_count;
+            }
+        }
+    }
+
+    return finish_biconnectivity(parents, discovery, tree_blocks, 1);
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrBiconnectivity CsrGraph<VertexId, WeightType>::parallel_biconnectivity(size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find biconnected components in empty graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+    constexpr size_t grain = 4096;
+
+    const size_t n = vertex_count();
+
+    // Levels of a BFS forest grown from the smallest vertex of every component
+    CsrComponents components = parallel_connected_components(thread_count);
+    std::vector<uint32_t> parents(n, none);
+    std::vector<uint32_t> frontier;
+    for (uint32_t v = 0; v < n; ++v) {
+        if (components.labels[v] == frontier.size()) {
+            parents[v] = v;
+            frontier.push_back(v);
+        }
+    }
+
+    // Deep, narrow forests would otherwise start threads for a handful of vertices per level
+    auto workers_for = [&](size_t count) { return std::min(thread_count, count / grain + 1); };
+
+    std::vector<std::vector<uint32_t>> levels;
+    std::vector<std::vector<uint32_t>> next(thread_count);
+    while (!frontier.empty()) {
+        parallel_for(frontier.size(), workers_for(frontier.size()), [&](size_t begin, size_t end, size_t worker) {
+            for (size_t i = begin; i < end; ++i) {
+                for (uint32_t neighbor : neighbors(frontier[i])) {
+                    uint32_t expected = none;
+                    if (std::atomic_ref<uint32_t>(parents[neighbor]).compare_exchange_strong(
+                            expected, frontier[i], std::memory_order_relaxed)) {
+                        next[worker].push_back(neighbor);
+                    }
+                }
+            }
+        });
+        levels.push_back(std::move(frontier));
+        frontier.clear();
+        for (auto& list : next) {
+            frontier.insert(frontier.end(), list.begin(), list.end());
+            list.clear();
+        }
+    }
+
+    // Subtree sizes bottom-up, then preorder numbers top-down: children take consecutive ranges
+    std::vector<uint32_t> sizes(n, 1);
+    for (size_t depth = levels.size(); depth-- > 1;) {
+        const auto& level = levels[depth];
+        parallel_for(level.size(), workers_for(level.size()), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                std::atomic_ref<uint32_t>(sizes[parents[level[i]]]).fetch_add(sizes[level[i]], std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::vector<uint32_t> preorder(n);
+    uint32_t next_number = 0;
+    for (uint32_t root : levels[0]) {
+        preorder[root] = next_number;
+        next_number += sizes[root];
+    }
+    for (const auto& level : levels) {
+        parallel_for(level.size(), workers_for(level.size()), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t number = preorder[level[i]] + 1;
+                for (uint32_t neighbor : neighbors(level[i])) {
+                    if (parents[neighbor] == level[i]) {
+                        preorder[neighbor] = number;
+                        number += sizes[neighbor];
+                    }
+                }
+            }
+        });
+    }
+
+    // low/high: smallest and largest preorder number reached from a subtree by a non-tree edge
+    auto is_tree_edge = [&parents](uint32_t u, uint32_t v) { return parents[u] == v || parents[v] == u; };
+    std::vector<uint32_t> low(n);
+    std::vector<uint32_t> high(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            low[v] = high[v] = preorder[v];
+            for (uint32_t neighbor : neighbors(static_cast<uint32_t>(v))) {
+                if (!is_tree_edge(static_cast<uint32_t>(v), neighbor)) {
+                    low[v] = std::min(low[v], preorder[neighbor]);
+                    high[v] = std::max(high[v], preorder[neighbor]);
+                }
+            }
+        }
+    });
+    for (size_t depth = levels.size(); depth-- > 1;) {
+        const auto& level = levels[depth];
+        parallel_for(level.size(), workers_for(level.size()), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t v = level[i];
+                std::atomic_ref<uint32_t> parent_low(low[parents[v]]);
+                uint32_t seen = parent_low.load(std::memory_order_relaxed);
+                while (low[v] < seen && !parent_low.compare_exchange_weak(seen, low[v], std::memory_order_relaxed)) {}
+
+                std::atomic_ref<uint32_t> parent_high(high[parents[v]]);
+                seen = parent_high.load(std::memory_order_relaxed);
+                while (high[v] > seen && !parent_high.compare_exchange_weak(seen, high[v], std::memory_order_relaxed)) {}
+            }
+        });
+    }
+
+    // Tarjan-Vishkin: tree edges (named by their child) are in one block when a non-tree edge joins
+    // two unrelated subtrees, or when a child's subtree reaches outside its parent's subtree
+    std::vector<uint32_t> blocks(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            blocks[v] = static_cast<uint32_t>(v);
+        }
+    });
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            const uint32_t child = static_cast<uint32_t>(v);
+            const uint32_t parent = parents[v];
+            if (parent == child) {
+                continue;
+            }
+            if (parents[parent] != parent &&
+                (low[v] < preorder[parent] || high[v] >= preorder[parent] + sizes[parent])) {
+                link_roots(blocks, child, parent);
+            }
+            for (uint32_t neighbor : neighbors(child)) {
+                if (!is_tree_edge(child, neighbor) && preorder[v] < preorder[neighbor] &&
+                    preorder[neighbor] >= preorder[v] + sizes[v]) {
+                    link_roots(blocks, child, neighbor);
+                }
+            }
+        }
+    });
+    compress_roots(blocks, thread_count);
+
+    return finish_biconnectivity(parents, preorder, blocks, thread_count);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+BiconnectivityResult<VertexId> Graph<VertexId, Resource, WeightType>::find_biconnected_components() {
+    if (vertex_pool_.empty()) {
+        throw std::runtime_error("Cannot find biconnected components in empty graph");
+    }
+
+    // Slots are the CSR indices
+    auto csr = freeze();
+    CsrBiconnectivity biconnectivity = csr.biconnectivity();
+
+    for (auto& [id, neighbors] : adjacency_list_) {
+        for (auto& [neighbor, edge_ptr] : neighbors) {
+            edge_arena_.edit(edge_ptr)->set_bridge(false);
+        }
+    }
+
+    BiconnectivityResult<VertexId> result;
+    for (const auto& [u, v] : biconnectivity.bridges) {
+        edge_arena_.edit(adjacency_list_.at(slot_ids_[u]).at(slot_ids_[v]))->set_bridge();
+        result.bridges.push_back(std::make_pair(slot_ids_[u], slot_ids_[v]));
+    }
+    for (uint32_t slot : biconnectivity.articulation_points) {
+        result.articulation_points.push_back(slot_ids_[slot]);
+    }
+
+    const auto& two_edge = biconnectivity.two_edge_components;
+    for (size_t i = 0; i < two_edge.count; ++i) {
+        result.two_edge_components.push_back(DynamicArray<VertexId>());
+    }
+    for (uint32_t slot = 0; slot < two_edge.labels.size(); ++slot) {
+        result.two_edge_components[two_edge.labels[slot]].push_back(slot_ids_[slot]);
+    }
+
+    // (block, vertex) pairs of both ends of every edge, deduplicated
+    std::vector<std::pair<uint32_t, uint32_t>> members;
+    for (uint32_t slot = 0; slot < csr.vertex_count(); ++slot) {
+        auto row = csr.neighbors(slot);
+        for (size_t k = 0; k < row.size(); ++k) {
+            members.emplace_back(biconnectivity.edge_blocks[csr.get_offsets()[slot] + k], slot);
+        }
+    }
+    std::sort(members.begin(), members.end());
+    members.erase(std::unique(members.begin(), members.end()), members.end());
+
+    for (size_t i = 0; i < biconnectivity.block_count; ++i) {
+        result.blocks.push_back(DynamicArray<VertexId>());
+    }
+    for (const auto& [block, slot] : members) {
+        result.blocks[block].push_back(slot_ids_[slot]);
+    }
+
+    return result;
+}
@@ -1,14 +1,36 @@
 #include "../../include/graph.hpp"
-#include "../../dependencies/Data_Structures/Containers/Stack.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include <fstream>
-#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 
 template <typename VertexId, typename Resource, typename WeightType>
-void Graph<VertexId, Resource, WeightType>::greedy_coloring(VertexId start) {
+ColoringResult<VertexId> Graph<VertexId, Resource, WeightType>::greedy_coloring(VertexId start) {
+    Workspace workspace;
+    ColoringResult<VertexId> result = std::as_const(*this).greedy_coloring(start, workspace);
+
+    reset_parameters();
+    for (const auto& [id, color] : result.colors) {
+        vertex_pool_.at(id).set_color(color);
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+ColoringResult<VertexId> Graph<VertexId, Resource, WeightType>::greedy_coloring(VertexId start,
+                                                                                Workspace& workspace) const {
     if (vertex_pool_.empty()) { 
         throw std::runtime_error("Cannot perform coloring on empty graph"); 
     }
@@ -17,57 +39,385 @@ void Graph<VertexId, Resource, WeightType>::greedy_coloring(VertexId start) {
         throw std::runtime_error("Start vertex doesn't exist in graph"); 
     }
 
-    reset_parameters();
+    const size_t slot_count = slot_ids_.size();
+    workspace.begin(slot_count);
+    auto& colors = workspace.colors_;
 
-    json parameters;
-    parameters["vertex_count"] = vertex_pool_.size();
-    parameters["start_vertex"] = start;
-    save_json_to_file("greedy_algorithms_parameters.json", parameters);
+    // One bit per color; a vertex only needs the first degree + 1 of them
+    auto& palette = workspace.palette_;
 
-    std::vector<bool> used_colors(vertex_count_, false);
-    
-    std::vector<VertexId> vertices;
-    vertices.reserve(vertex_pool_.size());
+    // Degrees are looked up once per vertex instead of on every comparison
+    auto& degrees = workspace.degrees_;
+    size_t max_degree = 0;
+    for (uint32_t slot = 0; slot < slot_count; ++slot) {
+        workspace.touch(slot);
+        auto adj_it = adjacency_list_.find(slot_ids_[slot]);
+        degrees[slot] = adj_it == adjacency_list_.end() ? 0 : adj_it->second.size();
+        max_degree = std::max(max_degree, degrees[slot]);
+    }
+
+    uint32_t source = slots_.at(start);
+    auto& vertices = workspace.order_;
     
-    for (const auto& [vertex_id, _] : vertex_pool_) {
-        if (vertex_id != start) {
-            vertices.push_back(vertex_id);
+    for (uint32_t slot = 0; slot < slot_count; ++slot) {
+        if (slot != source) {
+            vertices.push_back(slot);
         }
     }
     
-    std::sort(vertices.begin(), vertices.end(),
-        [this](const VertexId& a, const VertexId& b) {
-            return get_degree(a) > get_degree(b);
-        });
+    counting_sort_descending(vertices, max_degree, [&degrees](uint32_t slot) { return degrees[slot]; });
     
-    vertices.insert(vertices.begin(), start);
-
-    vertex_pool_[start].set_color(0);
+    vertices.insert(vertices.begin(), source);
 
     for (const auto& current : vertices) {
-        std::fill(used_colors.begin(), used_colors.end(), false);
-        
-        for (const auto& [neighbor, _] : adjacency_list_[current]) {
-            int neighbor_color = vertex_pool_[neighbor].get_color();
-            if (neighbor_color >= 0) {
-                used_colors[neighbor_color] = true;
+        const size_t limit = degrees[current];
+        std::fill_n(palette.begin(), limit / 64 + 1, 0);
+
+        auto adj_it = adjacency_list_.find(slot_ids_[current]);
+        if (adj_it != adjacency_list_.end()) {
+            for (const auto& [_, edge_ptr] : adj_it->second) {
+                size_t neighbor_color = colors[edge_ptr->opposite_slot(current)];
+                if (neighbor_color <= limit) { // no_color never is
+                    palette[neighbor_color >> 6] |= uint64_t(1) << (neighbor_color & 63);
+                }
             }
         }
         
-        int color = 0;
-        while (color < vertex_count_ && used_colors[color]) {
-            ++color;
+        size_t word = 0;
+        while (palette[word] == ~uint64_t(0)) {
+            ++word;
         }
         
-        vertex_pool_[current].set_color(color);
+        colors[current] = word * 64 + static_cast<size_t>(std::countr_one(palette[word]));
+    }
+
+    ColoringResult<VertexId> result;
+    result.start = start;
+    result.colors.reserve(slot_count);
+
+    for (uint32_t slot = 0; slot < slot_count; ++slot) {
+        result.colors[slot_ids_[slot]] = colors[slot];
+        result.color_count = std::max(result.color_count, colors[slot] + 1);
     }
 
-    json result;
-    result["coloring"] = json::object();
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::export_greedy_coloring(const ColoringResult<VertexId>& result) {
+    json parameters;
+    parameters["vertex_count"] = vertex_pool_.size();
+    parameters["start_vertex"] = result.start;
+    save_json_to_file("greedy_algorithms_parameters.json", parameters);
+
+    json coloring;
+    coloring["coloring"] = json::object();
     
-    for (const auto& [vertex_id, vertex] : vertex_pool_) {
-        result["coloring"][std::to_string(vertex_id)] = vertex.get_color();
+    for (const auto& [vertex_id, color] : result.colors) {
+        coloring["coloring"][std::to_string(vertex_id)] = color;
+    }
+
+    save_json_to_file("greedy_coloring_results.json", coloring);
+}
+
+
+template <typename VertexId, typename WeightType>
+std::vector<size_t> CsrGraph<VertexId, WeightType>::greedy_coloring(VertexId start) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform coloring on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex doesn't exist in graph");
+    }
+
+    uint32_t source = index_of(start);
+
+    std::vector<uint32_t> vertices;
+    vertices.reserve(vertex_count());
+    for (uint32_t i = 0; i < vertex_count(); ++i) {
+        if (i != source) {
+            vertices.push_back(i);
+        }
+    }
+
+    counting_sort_descending(vertices, max_degree(), [this](uint32_t v) { return degree(v); });
+
+    vertices.insert(vertices.begin(), source);
+
+    std::vector<size_t> colors(vertex_count(), no_color);
+    std::vector<uint64_t> palette(max_degree() / 64 + 1);
+
+    for (uint32_t current : vertices) {
+        colors[current] = first_free_color(current, colors, palette);
+    }
+
+    return colors;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+ColoringResult<VertexId> Graph<VertexId, Resource, WeightType>::welsh_powell_coloring() {
+    if (vertex_pool_.empty()) {
+        throw std::runtime_error("Cannot perform coloring on empty graph");
+    }
+
+    // Slots are the CSR indices, so the snapshot's colors map straight back
+    std::vector<size_t> colors = freeze().welsh_powell_coloring();
+
+    reset_parameters();
+
+    ColoringResult<VertexId> result;
+    result.start = slot_ids_[0];
+    result.colors.reserve(colors.size());
+
+    size_t first_degree = 0;
+    for (uint32_t slot = 0; slot < colors.size(); ++slot) {
+        const VertexId& id = slot_ids_[slot];
+        vertex_pool_.at(id).set_color(colors[slot]);
+        result.colors[id] = colors[slot];
+        result.color_count = std::max(result.color_count, colors[slot] + 1);
+
+        size_t degree = get_degree(id);
+        if (degree > first_degree) {
+            first_degree = degree;
+            result.start = id;
+        }
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+size_t CsrGraph<VertexId, WeightType>::first_free_color(uint32_t vertex, const std::vector<size_t>& colors,
+                                                        std::vector<uint64_t>& palette) const {
+    // The answer is at most the degree, so only the first degree + 1 bits matter and only their words are cleared
+    const size_t limit = degree(vertex);
+    std::fill_n(palette.begin(), limit / 64 + 1, 0);
+
+    for (uint32_t neighbor : neighbors(vertex)) {
+        size_t color = colors[neighbor];
+        if (color <= limit) {
+            palette[color >> 6] |= uint64_t(1) << (color & 63);
+        }
+    }
+
+    size_t word = 0;
+    while (palette[word] == ~uint64_t(0)) {
+        ++word;
+    }
+    return word * 64 + static_cast<size_t>(std::countr_one(palette[word]));
+}
+
+
+template <typename VertexId, typename WeightType>
+std::vector<size_t> CsrGraph<VertexId, WeightType>::ordered_coloring(ColoringOrder order) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform coloring on empty graph");
+    }
+
+    const size_t n = vertex_count();
+    std::vector<size_t> colors(n, no_color);
+    std::vector<uint64_t> palette(max_degree() / 64 + 1);
+
+    if (order == ColoringOrder::saturation) {
+        // Uncolored vertices keyed by (saturation, degree, ~index): the last entry is the next to color
+        using Key = std::tuple<size_t, size_t, uint32_t>;
+        std::set<Key> queue;
+        std::vector<HashTable<size_t, bool>> seen_colors(n);
+        for (uint32_t v = 0; v < n; ++v) {
+            queue.emplace(0, degree(v), ~v);
+        }
+
+        while (!queue.empty()) {
+            uint32_t current = ~std::get<2>(*queue.rbegin());
+            queue.erase(std::prev(queue.end()));
+
+            size_t color = first_free_color(current, colors, palette);
+            colors[current] = color;
+            HashTable<size_t, bool>().swap(seen_colors[current]);
+
+            for (uint32_t neighbor : neighbors(current)) {
+                if (colors[neighbor] != no_color || !seen_colors[neighbor].emplace(color, true).second) {
+                    continue;
+                }
+                size_t saturation = seen_colors[neighbor].size();
+                queue.erase(Key(saturation - 1, degree(neighbor), ~neighbor));
+                queue.emplace(saturation, degree(neighbor), ~neighbor);
+            }
+        }
+        return colors;
+    }
+
+    std::vector<uint32_t> vertices(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        vertices[v] = v;
+    }
+
+    if (order == ColoringOrder::largest_first) {
+        counting_sort_descending(vertices, max_degree(), [this](uint32_t v) { return degree(v); });
+    } else {
+        // Bucket queue keyed by remaining degree (Matula-Beck): vertices holds the buckets back to back,
+        // and removing a vertex moves each remaining neighbor to the front of its bucket and shrinks it
+        size_t max_degree = 0;
+        std::vector<size_t> remaining(n);
+        for (uint32_t v = 0; v < n; ++v) {
+            remaining[v] = degree(v);
+            max_degree = std::max(max_degree, remaining[v]);
+        }
+
+        std::vector<size_t> bucket_start(max_degree + 2, 0);
+        for (uint32_t v = 0; v < n; ++v) {
+            ++bucket_start[remaining[v] + 1];
+        }
+        for (size_t d = 1; d < bucket_start.size(); ++d) {
+            bucket_start[d] += bucket_start[d - 1];
+        }
+
+        std::vector<size_t> position(n);
+        std::vector<size_t> fill(bucket_start.begin(), bucket_start.end() - 1);
+        for (uint32_t v = 0; v < n; ++v) {
+            position[v] = fill[remaining[v]]++;
+            vertices[position[v]] = v;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t current = vertices[i];
+            for (uint32_t neighbor : neighbors(current)) {
+                if (position[neighbor] <= i || remaining[neighbor] <= remaining[current]) {
+                    continue;
+                }
+                size_t d = remaining[neighbor];
+                size_t front = std::max(bucket_start[d], i + 1);
+                uint32_t swapped = vertices[front];
+                std::swap(vertices[front], vertices[position[neighbor]]);
+                position[swapped] = position[neighbor];
+                position[neighbor] = front;
+                bucket_start[d] = front + 1;
+                --remaining[neighbor];
+            }
+        }
+
+        // Vertices were removed smallest degree first; color them the other way round
+        std::reverse(vertices.begin(), vertices.end());
+    }
+
+    for (uint32_t current : vertices) {
+        colors[current] = first_free_color(current, colors, palette);
+    }
+    return colors;
+}
+
+
+template <typename VertexId, typename WeightType>
+std::vector<size_t> CsrGraph<VertexId, WeightType>::welsh_powell_coloring() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform coloring on empty graph");
+    }
+
+    const size_t n = vertex_count();
+    std::vector<uint32_t> uncolored(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        uncolored[v] = v;
+    }
+    counting_sort_descending(uncolored, max_degree(), [this](uint32_t v) { return degree(v); });
+
+    std::vector<size_t> colors(n, no_color);
+
+    // blocked[v] == color means a neighbor of v already took color in this pass
+    std::vector<size_t> blocked(n, no_color);
+
+    for (size_t color = 0; !uncolored.empty(); ++color) {
+        size_t kept = 0;
+        for (uint32_t current : uncolored) {
+            if (blocked[current] == color) {
+                uncolored[kept++] = current;
+                continue;
+            }
+            colors[current] = color;
+            for (uint32_t neighbor : neighbors(current)) {
+                blocked[neighbor] = color;
+            }
+        }
+        uncolored.resize(kept);
+    }
+
+    return colors;
+}
+
+
+template <typename VertexId, typename WeightType>
+std::vector<size_t> CsrGraph<VertexId, WeightType>::parallel_coloring(size_t thread_count, uint64_t seed) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform coloring on empty graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    const size_t n = vertex_count();
+
+    // Random priorities (splitmix64), ties broken by index
+    std::vector<uint64_t> priorities(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            uint64_t z = v + seed * 0x9e3779b97f4a7c15ULL + 0x9e3779b97f4a7c15ULL;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            priorities[v] = z ^ (z >> 31);
+        }
+    });
+    auto precedes = [&priorities](uint32_t a, uint32_t b) {
+        return priorities[a] > priorities[b] || (priorities[a] == priorities[b] && a > b);
+    };
+
+    // waiting[v] counts the neighbors that have to be colored before v
+    std::vector<uint32_t> waiting(n, 0);
+    std::vector<std::vector<uint32_t>> ready(thread_count);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t v = begin; v < end; ++v) {
+            for (uint32_t neighbor : neighbors(static_cast<uint32_t>(v))) {
+                waiting[v] += precedes(neighbor, static_cast<uint32_t>(v));
+            }
+            if (waiting[v] == 0) {
+                ready[worker].push_back(static_cast<uint32_t>(v));
+            }
+        }
+    });
+
+    std::vector<size_t> colors(n, no_color);
+    std::vector<std::vector<uint64_t>> palettes(thread_count);
+    const size_t palette_words = max_degree() / 64 + 1;
+
+    // A round colors vertices that are never adjacent: two neighbors can't both have nothing left to wait for
+    std::vector<uint32_t> frontier;
+    while (true) {
+        frontier.clear();
+        for (auto& list : ready) {
+            frontier.insert(frontier.end(), list.begin(), list.end());
+            list.clear();
+        }
+        if (frontier.empty()) {
+            break;
+        }
+
+        parallel_for(frontier.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+            auto& palette = palettes[worker];
+            palette.resize(palette_words);
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t current = frontier[i];
+                colors[current] = first_free_color(current, colors, palette);
+
+                for (uint32_t neighbor : neighbors(current)) {
+                    if (precedes(current, neighbor) &&
+                        std::atomic_ref<uint32_t>(waiting[neighbor]).fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        ready[worker].push_back(neighbor);
+                    }
+                }
+            }
+        });
     }
 
-    save_json_to_file("greedy_coloring_results.json", result);
+    return colors;
 }
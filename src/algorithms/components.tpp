@@ -1,14 +1,26 @@
 #include "../../include/graph.hpp"
-#include "../../dependencies/Data_Structures/Containers/Stack.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include <fstream>
-#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 template <typename VertexId, typename Resource, typename WeightType>
-DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find_connected_components() {
+DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find_connected_components() const {
+    Workspace workspace;
+    return find_connected_components(workspace);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find_connected_components(
+        Workspace& workspace) const {
     if (vertex_count_ == 0) {
         throw std::runtime_error("Cannot find components in empty graph");
     }
@@ -18,37 +30,33 @@ DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find
     }
 
     DynamicArray<DynamicArray<VertexId>> components;
-    HashTable<VertexId, bool> visited;
-
-    // Initialize visited map for all vertices
-    for (const auto& [id, _] : vertex_pool_) {
-        visited[id] = false;
-    }
+    workspace.begin(slot_ids_.size());
+    auto& stack = workspace.stack_;
 
     // Process each unvisited vertex
-    for (const auto& [vertex_id, _] : vertex_pool_) {
-        if (!visited[vertex_id]) {
+    for (uint32_t slot = 0; slot < slot_ids_.size(); ++slot) {
+        if (!workspace.touched(slot)) {
             DynamicArray<VertexId> current_component;
-            Stack<VertexId> stack;
             
             // Process current component
-            stack.push(vertex_id);
-            visited[vertex_id] = true;
-            current_component.push_back(vertex_id);
+            stack.push_back(slot);
+            workspace.touch(slot);
+            current_component.push_back(slot_ids_[slot]);
 
             while (!stack.empty()) {
-                VertexId current = stack.top();
-                stack.pop();
+                uint32_t current = stack.back();
+                stack.pop_back();
 
                 // Check if current vertex exists in adjacency list
-                auto adj_it = adjacency_list_.find(current);
+                auto adj_it = adjacency_list_.find(slot_ids_[current]);
                 if (adj_it != adjacency_list_.end()) {
                     // Process all neighbors
-                    for (const auto& [neighbor_id, edge] : adj_it->second) {
-                        if (!visited[neighbor_id]) {
-                            stack.push(neighbor_id);
-                            visited[neighbor_id] = true;
-                            current_component.push_back(neighbor_id);
+                    for (const auto& [_, edge_ptr] : adj_it->second) {
+                        uint32_t neighbor = edge_ptr->opposite_slot(current);
+                        if (!workspace.touched(neighbor)) {
+                            stack.push_back(neighbor);
+                            workspace.touch(neighbor);
+                            current_component.push_back(slot_ids_[neighbor]);
                         }
                     }
                 }
@@ -58,7 +66,110 @@ DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find
         }
     }
 
-    // Create JSON output
+    return components;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::track_components(bool enabled) {
+    track_components_ = enabled;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::refresh_component_sets() {
+    if (!component_sets_stale_) {
+        return;
+    }
+
+    component_sets_.reset(slot_ids_.size());
+    for (const auto& [from, edges] : adjacency_list_) {
+        for (const auto& [_, edge_ptr] : edges) {
+            if (edge_ptr->get_from() == from) {
+                component_sets_.unite(edge_ptr->get_from_slot(), edge_ptr->get_to_slot());
+            }
+        }
+    }
+    component_sets_stale_ = false;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::enable_dynamic_connectivity() {
+    if (!connectivity_) {
+        connectivity_ = std::make_unique<DynamicConnectivity<VertexId>>();
+        rebuild_connectivity();
+    }
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::disable_dynamic_connectivity() {
+    connectivity_.reset();
+}
+
+
+// For bulk changes that bypass add_vertex/add_edge
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::rebuild_connectivity() {
+    if (!connectivity_) {
+        return;
+    }
+
+    connectivity_->clear();
+    for (const auto& id : slot_ids_) {
+        connectivity_->add_vertex(id);
+    }
+    for (const auto& [from, edges] : adjacency_list_) {
+        for (const auto& [to, edge_ptr] : edges) {
+            if (edge_ptr->get_from() == from) {
+                connectivity_->add_edge(from, to);
+            }
+        }
+    }
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+bool Graph<VertexId, Resource, WeightType>::same_component(const VertexId& u, const VertexId& v) {
+    if (!has_vertex(u) || !has_vertex(v)) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+
+    if (connectivity_) {
+        return connectivity_->connected(u, v);
+    }
+    refresh_component_sets();
+    return component_sets_.same_set(slots_.at(u), slots_.at(v));
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+size_t Graph<VertexId, Resource, WeightType>::component_count() {
+    if (connectivity_) {
+        return connectivity_->component_count();
+    }
+    refresh_component_sets();
+    return component_sets_.set_count();
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+size_t Graph<VertexId, Resource, WeightType>::component_size(const VertexId& vertex) {
+    if (!has_vertex(vertex)) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+
+    if (connectivity_) {
+        return connectivity_->component_size(vertex);
+    }
+    refresh_component_sets();
+    return component_sets_.set_size(slots_.at(vertex));
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::export_components(const DynamicArray<DynamicArray<VertexId>>& components) {
     json components_data;
     components_data["components_count"] = components.size();
     components_data["components"] = json::array();
@@ -72,12 +183,165 @@ DynamicArray<DynamicArray<VertexId>> Graph<VertexId, Resource, WeightType>::find
         components_data["components"].push_back(component);
     }
 
-    // Save to file with directory creation
-    std::string directory = "files";
-    if (!std::filesystem::exists(directory)) {
-        std::filesystem::create_directory(directory);
-    }
     save_json_to_file("components.json", components_data);
+}
 
-    return components;
+
+template <typename VertexId, typename WeightType>
+CsrComponents CsrGraph<VertexId, WeightType>::find_connected_components() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find components in empty graph");
+    }
+
+    constexpr uint32_t unlabeled = std::numeric_limits<uint32_t>::max();
+
+    CsrComponents result;
+    result.labels.assign(vertex_count(), unlabeled);
+    std::vector<uint32_t> stack;
+
+    for (uint32_t vertex = 0; vertex < vertex_count(); ++vertex) {
+        if (result.labels[vertex] != unlabeled) {
+            continue;
+        }
+
+        uint32_t label = static_cast<uint32_t>(result.count++);
+        result.labels[vertex] = label;
+        stack.push_back(vertex);
+
+        while (!stack.empty()) {
+            uint32_t current = stack.back();
+            stack.pop_back();
+
+            for (uint32_t neighbor : neighbors(current)) {
+                if (result.labels[neighbor] == unlabeled) {
+                    result.labels[neighbor] = label;
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrComponents CsrGraph<VertexId, WeightType>::parallel_connected_components(size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find components in empty graph");
+    }
+
+    const size_t n = vertex_count();
+    std::vector<uint32_t> parents(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            parents[v] = static_cast<uint32_t>(v);
+        }
+    });
+
+    // Afforest: link along the first few edges of every vertex, which already merges most of a
+    // large component, then skip the remaining edges of whatever landed in that component
+    constexpr size_t sampled_rounds = 2;
+    for (size_t round = 0; round < sampled_rounds; ++round) {
+        parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t v = begin; v < end; ++v) {
+                if (offsets_[v] + round < offsets_[v + 1]) {
+                    link_roots(parents, static_cast<uint32_t>(v), neighbors_[offsets_[v] + round]);
+                }
+            }
+        });
+        compress_roots(parents, thread_count);
+    }
+
+    // The most frequent root among a fixed sample of vertices is taken as the giant component
+    constexpr size_t sample_size = 1024;
+    HashTable<uint32_t, size_t> frequency;
+    uint32_t giant = parents[0];
+    size_t giant_count = 0;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    for (size_t i = 0; i < sample_size; ++i) {
+        uint32_t root = parents[pick(rng)];
+        size_t count = ++frequency[root];
+        if (count > giant_count) {
+            giant = root;
+            giant_count = count;
+        }
+    }
+
+    // Edges are undirected, so an edge between the giant component and the rest is still seen from the other side
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            if (std::atomic_ref<uint32_t>(parents[v]).load(std::memory_order_relaxed) == giant) {
+                continue;
+            }
+            for (size_t e = offsets_[v] + sampled_rounds; e < offsets_[v + 1]; ++e) {
+                link_roots(parents, static_cast<uint32_t>(v), neighbors_[e]);
+            }
+        }
+    });
+    compress_roots(parents, thread_count);
+
+    // Roots are the smallest vertex of their component, so numbering them in index order gives the
+    // same labels as the serial search
+    return label_roots(parents, thread_count);
+}
+
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::link_roots(std::vector<uint32_t>& parents, uint32_t u, uint32_t v) {
+    uint32_t p1 = std::atomic_ref<uint32_t>(parents[u]).load(std::memory_order_relaxed);
+    uint32_t p2 = std::atomic_ref<uint32_t>(parents[v]).load(std::memory_order_relaxed);
+    while (p1 != p2) {
+        uint32_t high = std::max(p1, p2);
+        uint32_t low = std::min(p1, p2);
+        std::atomic_ref<uint32_t> high_parent(parents[high]);
+        uint32_t expected = high_parent.load(std::memory_order_relaxed);
+        if (expected == low) {
+            break;
+        }
+        if (expected == high && high_parent.compare_exchange_strong(expected, low, std::memory_order_relaxed)) {
+            break;
+        }
+        p1 = std::atomic_ref<uint32_t>(parents[expected]).load(std::memory_order_relaxed);
+        p2 = std::atomic_ref<uint32_t>(parents[low]).load(std::memory_order_relaxed);
+    }
+}
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::compress_roots(std::vector<uint32_t>& parents, size_t thread_count) {
+    parallel_for(parents.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            std::atomic_ref<uint32_t> parent(parents[v]);
+            uint32_t root = parent.load(std::memory_order_relaxed);
+            while (true) {
+                uint32_t next = std::atomic_ref<uint32_t>(parents[root]).load(std::memory_order_relaxed);
+                if (next == root) {
+                    break;
+                }
+                root = next;
+            }
+            parent.store(root, std::memory_order_relaxed);
+        }
+    });
+}
+
+template <typename VertexId, typename WeightType>
+CsrComponents CsrGraph<VertexId, WeightType>::label_roots(const std::vector<uint32_t>& parents, size_t thread_count) {
+    const size_t n = parents.size();
+    CsrComponents result;
+    std::vector<uint32_t> dense(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        if (parents[v] == v) {
+            dense[v] = static_cast<uint32_t>(result.count++);
+        }
+    }
+
+    result.labels.resize(n);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            result.labels[v] = dense[parents[v]];
+        }
+    });
+    return result;
 }
@@ -0,0 +1,154 @@
+#include "../../include/graph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+
+template <typename VertexId, typename WeightType>
+CsrShortestPaths<WeightType> CsrGraph<VertexId, WeightType>::delta_stepping(VertexId start,
+                                                                            std::optional<WeightType> bucket_width,
+                                                                            size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform delta-stepping on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex does not exist in graph");
+    }
+    // Written so that NaN fails as well, and 0 for unsigned weights
+    if (bucket_width && !(*bucket_width > 0)) {
+        throw std::invalid_argument("Bucket width must be positive");
+    }
+    require_non_negative_weights("Delta-stepping");
+
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    const size_t n = vertex_count();
+    const WeightType infinity = std::numeric_limits<WeightType>::max();
+    WeightType max_weight = weights_.empty() ? WeightType(0) : *std::max_element(weights_.begin(), weights_.end());
+
+    WeightType delta;
+    if (bucket_width) {
+        delta = *bucket_width;
+    } else {
+        // Meyer and Sanders: roughly one bucket per average degree worth of weight
+        delta = max_weight / static_cast<WeightType>(std::max<size_t>(1, neighbors_.size() / n));
+        if (!(delta > 0)) {
+            delta = 1;
+        }
+    }
+
+    CsrShortestPaths<WeightType> result;
+    result.distances.assign(n, infinity);
+    result.previous.resize(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        result.previous[i] = i;
+    }
+    auto& distances = result.distances;
+
+    // Only non-empty buckets exist, so a narrow delta against wide weights costs neither memory
+    // for max_weight / delta buckets nor a walk over the empty ones
+    auto bucket_of = [delta](WeightType distance) { return static_cast<size_t>(distance / delta); };
+    std::map<size_t, std::vector<uint32_t>> buckets;
+
+    // Relaxations are generated against a frozen distance array and applied by the worker owning
+    // the target range, so neither phase needs atomics
+    struct Request {
+        uint32_t vertex;
+        uint32_t parent;
+        WeightType distance;
+    };
+    const size_t owner_span = (n + thread_count - 1) / thread_count;
+    std::vector<std::vector<std::vector<Request>>> requests(thread_count,
+                                                           std::vector<std::vector<Request>>(thread_count));
+    std::vector<std::vector<uint32_t>> improved(thread_count);
+
+    auto relax = [&](const std::vector<uint32_t>& sources, bool light) {
+        parallel_for(sources.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+            auto& outgoing = requests[worker];
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t u = sources[i];
+                for (size_t e = offsets_[u]; e < offsets_[u + 1]; ++e) {
+                    if ((weights_[e] <= delta) != light) {
+                        continue;
+                    }
+                    WeightType candidate = distances[u] + weights_[e];
+                    uint32_t v = neighbors_[e];
+                    if (candidate < distances[v]) {
+                        outgoing[v / owner_span].push_back({v, u, candidate});
+                    }
+                }
+            }
+        });
+
+        parallel_for(thread_count, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t owner = begin; owner < end; ++owner) {
+                improved[owner].clear();
+                for (auto& outgoing : requests) {
+                    for (const Request& request : outgoing[owner]) {
+                        if (request.distance < distances[request.vertex]) {
+                            // Re-queued even within the same bucket, its edges have to be relaxed again
+                            improved[owner].push_back(request.vertex);
+                            distances[request.vertex] = request.distance;
+                            result.previous[request.vertex] = request.parent;
+                        }
+                    }
+                    outgoing[owner].clear();
+                }
+            }
+        });
+
+        for (const auto& vertices : improved) {
+            for (uint32_t v : vertices) {
+                buckets[bucket_of(distances[v])].push_back(v);
+            }
+        }
+    };
+
+    uint32_t source = index_of(start);
+    distances[source] = 0;
+    buckets[0].push_back(source);
+
+    std::vector<uint32_t> bucket;
+    std::vector<uint32_t> frontier;
+    std::vector<uint32_t> settled;
+    std::vector<size_t> frontier_mark(n, std::numeric_limits<size_t>::max());
+    std::vector<size_t> settled_mark(n, std::numeric_limits<size_t>::max());
+    size_t round = 0;
+
+    while (!buckets.empty()) {
+        // Relaxations never reach below the current bucket, so the smallest key is the next one to settle
+        const size_t current = buckets.begin()->first;
+        settled.clear();
+
+        // Light edges can refill the current bucket, so it is drained until it stays empty
+        for (auto it = buckets.begin(); it != buckets.end() && it->first == current; it = buckets.begin()) {
+            ++round;
+            frontier.clear();
+            bucket.swap(it->second);
+            buckets.erase(it);
+            for (uint32_t v : bucket) {
+                // Entries left behind by a later improvement into another bucket are stale
+                if (bucket_of(distances[v]) == current && frontier_mark[v] != round) {
+                    frontier_mark[v] = round;
+                    frontier.push_back(v);
+                    if (settled_mark[v] != current) {
+                        settled_mark[v] = current;
+                        settled.push_back(v);
+                    }
+                }
+            }
+            bucket.clear();
+            relax(frontier, true);
+        }
+
+        relax(settled, false);
+    }
+
+    return result;
+}
@@ -1,12 +1,24 @@
 #include "../../include/graph.hpp"
-#include "../../dependencies/Data_Structures/Containers/Stack.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include <fstream>
-#include <filesystem>
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 template <typename VertexId, typename Resource, typename WeightType>
-void Graph<VertexId, Resource, WeightType>::depth_first_search(VertexId start) {
+TraversalResult<VertexId> Graph<VertexId, Resource, WeightType>::depth_first_search(VertexId start) {
+    Workspace workspace;
+    TraversalResult<VertexId> result = std::as_const(*this).depth_first_search(start, workspace);
+
+    reset_parameters();
+    store_traversal(result);
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+TraversalResult<VertexId> Graph<VertexId, Resource, WeightType>::depth_first_search(VertexId start,
+                                                                                    Workspace& workspace) const {
     // Check if graph is empty
     if (vertex_pool_.empty()) {
         throw std::runtime_error("Cannot perform DFS on empty graph");
@@ -17,49 +29,117 @@ void Graph<VertexId, Resource, WeightType>::depth_first_search(VertexId start) {
         throw std::runtime_error("Start vertex does not exist in graph");
     }
 
-    reset_parameters();
+    workspace.begin(slot_ids_.size());
+    auto& order = workspace.order_;
+    auto& discovery_times = workspace.discovery_times_;
+    auto& finish_times = workspace.finish_times_;
+    auto& stack = workspace.stack_;
+
+    // Every vertex on the stack keeps a cursor into its edge list, so a neighbor is never rescanned.
+    // A vertex is white until the workspace touches it and black once it has a finish time
+    auto& cursors = workspace.cursors_;
+
+    auto open_vertex = [&](uint32_t slot) {
+        workspace.touch(slot);
+        auto adj_it = adjacency_list_.find(slot_ids_[slot]);
+        if (adj_it != adjacency_list_.end()) {
+            cursors[slot] = {adj_it->second.cbegin(), adj_it->second.cend()};
+        } else {
+            cursors[slot] = {};
+        }
+    };
+
+    size_t timer = 0;
+
+    // Start DFS from the start vertex
+    uint32_t source = slots_.at(start);
+    stack.push_back(source);
+    open_vertex(source);
+    order.push_back(source);
+    discovery_times[source] = timer++;
+
+    while (!stack.empty()) {
+        uint32_t current = stack.back();
+        bool has_unvisited_neighbors = false;
+
+        // Check remaining neighbors of current vertex
+        auto& [it, end] = cursors[current];
+        while (it != end) {
+            uint32_t neighbor = (it++)->second->opposite_slot(current);
+            if (!workspace.touched(neighbor)) { // White vertex
+                stack.push_back(neighbor);
+                open_vertex(neighbor);
+                order.push_back(neighbor);
+                discovery_times[neighbor] = timer++;
+                has_unvisited_neighbors = true;
+                break;
+            }
+        }
 
-    // Create parameters for logging
+        // If all neighbors are visited, finish current vertex
+        if (!has_unvisited_neighbors) {
+            stack.pop_back();
+            finish_times[current] = timer++;
+        }
+    }
+
+    return collect_traversal(start, workspace);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::export_dfs(const TraversalResult<VertexId>& result) {
     json parameters;
     parameters["vertex_count"] = vertex_pool_.size();
-    parameters["start_vertex"] = start;
+    parameters["start_vertex"] = result.start;
     save_json_to_file("dfs_parameters.json", parameters);
+}
 
-    Stack<VertexId> stack;
-    size_t timer = 0;
 
-    // Start DFS from the start vertex
-    stack.push(start);
-    vertex_pool_[start].set_color(1); // Gray
-    vertex_pool_[start].set_discovery_time(timer++);
-
-    // Handle single-vertex case
-    if (vertex_pool_.size() == 1) {
-        vertex_pool_[start].set_color(2); // Black
-        vertex_pool_[start].set_finish_time(timer++);
-        return;
+template <typename VertexId, typename WeightType>
+CsrTraversal CsrGraph<VertexId, WeightType>::depth_first_search(VertexId start) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform DFS on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex does not exist in graph");
     }
 
+    CsrTraversal result;
+    result.discovery_time.assign(vertex_count(), -1);
+    result.finish_time.assign(vertex_count(), -1);
+    result.order.reserve(vertex_count());
+
+    // Each vertex remembers where its neighbor scan stopped, so every edge is looked at once
+    std::vector<size_t> next_edge(offsets_.begin(), offsets_.end() - 1);
+    std::vector<uint32_t> stack;
+
+    int timer = 0;
+    uint32_t source = index_of(start);
+    stack.push_back(source);
+    result.order.push_back(source);
+    result.discovery_time[source] = timer++;
+
     while (!stack.empty()) {
-        VertexId current = stack.top();
+        uint32_t current = stack.back();
         bool has_unvisited_neighbors = false;
 
-        // Check all neighbors of current vertex
-        for (const auto& [neighbor, edge_ptr] : adjacency_list_[current]) {
-            if (vertex_pool_[neighbor].get_color() == 0) { // White vertex
-                stack.push(neighbor);
-                vertex_pool_[neighbor].set_color(1); // Gray
-                vertex_pool_[neighbor].set_discovery_time(timer++);
+        while (next_edge[current] < offsets_[current + 1]) {
+            uint32_t neighbor = neighbors_[next_edge[current]++];
+            if (result.discovery_time[neighbor] == -1) {
+                stack.push_back(neighbor);
+                result.order.push_back(neighbor);
+                result.discovery_time[neighbor] = timer++;
                 has_unvisited_neighbors = true;
                 break;
             }
         }
 
-        // If all neighbors are visited, finish current vertex
         if (!has_unvisited_neighbors) {
-            stack.pop();
-            vertex_pool_[current].set_color(2); // Black
-            vertex_pool_[current].set_finish_time(timer++);
+            stack.pop_back();
+            result.finish_time[current] = timer++;
         }
     }
+
+    return result;
 }
@@ -1,16 +1,36 @@
 #include "../../include/graph.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include "../../dependencies/Data_Structures/Containers/Pair.hpp"
-#include "../../dependencies/Data_Structures/Containers/Priority_Queue.hpp"
-#include "../../dependencies/Data_Structures/Containers/Queue.hpp"
+#include "../../include/priority_queues.hpp"
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <queue>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 template <typename VertexId, typename Resource, typename WeightType>
-void Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start) {
+template <template <typename> class Queue>
+ShortestPathsResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start) {
+    Workspace workspace;
+    ShortestPathsResult<VertexId, WeightType> result = std::as_const(*this).template dijkstra<Queue>(start, workspace);
+
+    // Reset graph state
+    reset_parameters();
+    for (const auto& [id, _] : result.distances) {
+        vertex_pool_.at(id).set_color(2);
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+template <template <typename> class Queue>
+ShortestPathsResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start,
+                                                                                         Workspace& workspace) const {
     if (vertex_pool_.empty()) {
         throw std::runtime_error("Cannot perform Dijkstra on empty graph");
     }
@@ -18,49 +38,32 @@ void Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start) {
         throw std::runtime_error("Start vertex does not exist in graph");
     }
 
-    
-    // Check for negative weights which Dijkstra cannot handle
-    for (const auto& [vertex_id, _] : vertex_pool_) {
-        for (const auto& [neighbor, edge_ptr] : adjacency_list_[vertex_id]) {
-            if (edge_ptr->get_weight() < 0) {
-                throw std::runtime_error("Dijkstra's algorithm cannot handle negative weights");
-            }
-        }
+    // Check for negative weights which Dijkstra cannot handle; the arena keeps count, so no edge scan
+    if (edge_arena_.negative_weight_count() > 0) {
+        throw std::runtime_error("Dijkstra's algorithm cannot handle negative weights");
     }
+    WeightType max_weight = edge_arena_.max_weight();
 
-
-    // Reset graph state
-    reset_parameters();
-
-    json parameters;
-    parameters["vertex_count"] = vertex_pool_.size();
-    parameters["start_vertex"] = start;
-    save_json_to_file("dijkstra_parameters.json", parameters);
-
-    HashTable<VertexId, WeightType> distances;
-    HashTable<VertexId, VertexId> previous;
-    HashTable<VertexId, size_t> visit_count;
-    PriorityQueue<Pair<WeightType, VertexId>> pq;
-
-    // Initialize distances
-    for (const auto& [vertex_id, _] : vertex_pool_) {
-        distances[vertex_id] = std::numeric_limits<WeightType>::max();
-        previous[vertex_id] = vertex_id; // Initialize each vertex as its own predecessor
-    }
+    // Only slots the search reaches are ever touched, so a query costs O(reached) and not O(V)
+    const size_t slot_count = slot_ids_.size();
+    workspace.begin(slot_count);
+    auto& distances = workspace.distances_;
+    auto& previous = workspace.previous_;
+    auto& colors = workspace.states_;
+    auto& reached = workspace.order_;
+    auto& pq = workspace.template queue<Queue<WeightType>>(slot_count, max_weight);
 
     // Set start vertex
-    distances[start] = 0;
-    pq.push(0, {0, start}); // Pass priority and item
-    vertex_pool_[start].set_color(1); // Mark as in progress
+    uint32_t source = slots_.at(start);
+    workspace.touch(source);
+    distances[source] = 0;
+    pq.push(source, 0);
+    colors[source] = 1; // Mark as in progress
+    reached.push_back(source);
 
     // Main Dijkstra loop
     while (!pq.empty()) {
-        auto current_node = pq.top();
-        pq.pop();
-        
-        auto current = current_node.item; // Extract Pair from PriorityNode
-        VertexId current_vertex = current.second_;
-        WeightType current_distance = current.first_;
+        auto [current_distance, current_vertex] = pq.pop();
 
         // Skip if we've found a better path already
         if (current_distance > distances[current_vertex]) {
@@ -68,12 +71,22 @@ void Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start) {
         }
 
         // Mark as processed
-        vertex_pool_[current_vertex].set_color(2);
+        colors[current_vertex] = 2;
+
+        auto adj_it = adjacency_list_.find(slot_ids_[current_vertex]);
+        if (adj_it == adjacency_list_.end()) {
+            continue;
+        }
 
         // Process neighbors
-        for (const auto& [neighbor, edge_ptr] : adjacency_list_[current_vertex]) {
+        for (const auto& [_, edge_ptr] : adj_it->second) {
+            uint32_t neighbor = edge_ptr->opposite_slot(current_vertex);
+
             // Skip processed vertices
-            if (vertex_pool_[neighbor].get_color() == 2) {
+            if (!workspace.touched(neighbor)) {
+                workspace.touch(neighbor);
+                reached.push_back(neighbor);
+            } else if (colors[neighbor] == 2) {
                 continue;
             }
 
@@ -84,33 +97,110 @@ void Graph<VertexId, Resource, WeightType>::dijkstra(VertexId start) {
             if (new_distance < distances[neighbor]) {
                 distances[neighbor] = new_distance;
                 previous[neighbor] = current_vertex;
-                pq.push(new_distance, {new_distance, neighbor}); // Pass priority and item
-                vertex_pool_[neighbor].set_color(1);
+                pq.push(neighbor, new_distance);
+                colors[neighbor] = 1;
             }
         }
     }
 
-    // Save results
-    json result;
-    result["distances"] = json::object();
-    result["paths"] = json::object();
-
-    // Store distances and reconstruct paths
-    for (const auto& [vertex_id, distance] : distances) {
-        result["distances"][std::to_string(vertex_id)] = distance;
-        
-        // Reconstruct path
-        std::vector<VertexId> path;
-        VertexId current = vertex_id;
-        while (current != start) {
-            path.push_back(current);
-            current = previous[current];
+    ShortestPathsResult<VertexId, WeightType> result;
+    result.start = start;
+    result.distances.reserve(reached.size());
+    result.previous.reserve(reached.size());
+
+    for (uint32_t slot : reached) {
+        const VertexId& id = slot_ids_[slot];
+        result.distances[id] = distances[slot];
+        result.previous[id] = slot_ids_[previous[slot]];
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::export_dijkstra(const ShortestPathsResult<VertexId, WeightType>& result) {
+    json parameters;
+    parameters["vertex_count"] = vertex_pool_.size();
+    parameters["start_vertex"] = result.start;
+    save_json_to_file("dijkstra_parameters.json", parameters);
+
+    json data;
+    data["distances"] = json::object();
+    data["paths"] = json::object();
+
+    // Unreachable vertices keep an infinite distance and an empty path
+    for (const auto& [vertex_id, _] : vertex_pool_) {
+        const std::string key = std::to_string(vertex_id);
+
+        auto it = result.distances.find(vertex_id);
+        data["distances"][key] = it == result.distances.end() ? std::numeric_limits<WeightType>::max() : it->second;
+
+        json path_array = json::array();
+        for (const auto& vertex : result.path_to(vertex_id)) {
+            path_array.push_back(vertex);
+        }
+        data["paths"][key] = path_array;
+    }
+
+    save_json_to_file("dijkstra_results.json", data);
+}
+
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::require_non_negative_weights(const std::string& algorithm) const {
+    for (const WeightType& weight : weights_) {
+        if (weight < 0) {
+            throw std::runtime_error(algorithm + " cannot handle negative weights");
+        }
+    }
+}
+
+template <typename VertexId, typename WeightType>
+template <template <typename> class Queue>
+CsrShortestPaths<WeightType> CsrGraph<VertexId, WeightType>::dijkstra(VertexId start) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot perform Dijkstra on empty graph");
+    }
+    if (!has_vertex(start)) {
+        throw std::runtime_error("Start vertex does not exist in graph");
+    }
+
+    require_non_negative_weights("Dijkstra's algorithm");
+
+    CsrShortestPaths<WeightType> result;
+    result.distances.assign(vertex_count(), std::numeric_limits<WeightType>::max());
+    result.previous.resize(vertex_count());
+    for (uint32_t i = 0; i < vertex_count(); ++i) {
+        result.previous[i] = i;
+    }
+
+    WeightType max_weight = weights_.empty() ? WeightType(0) : *std::max_element(weights_.begin(), weights_.end());
+    Queue<WeightType> pq(vertex_count(), max_weight);
+
+    uint32_t source = index_of(start);
+    result.distances[source] = 0;
+    pq.push(source, 0);
+
+    while (!pq.empty()) {
+        auto [current_distance, current] = pq.pop();
+
+        // Skip stale entries
+        if (current_distance > result.distances[current]) {
+            continue;
+        }
+
+        for (size_t e = offsets_[current]; e < offsets_[current + 1]; ++e) {
+            uint32_t neighbor = neighbors_[e];
+            WeightType new_distance = current_distance + weights_[e];
+
+            if (new_distance < result.distances[neighbor]) {
+                result.distances[neighbor] = new_distance;
+                result.previous[neighbor] = current;
+                pq.push(neighbor, new_distance);
+            }
         }
-        path.push_back(start);
-        std::reverse(path.begin(), path.end());
-        
-        result["paths"][std::to_string(vertex_id)] = path;
     }
 
-    save_json_to_file("dijkstra_results.json", result);
+    return result;
 }
@@ -0,0 +1,172 @@
+#include "../../include/graph.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+template <typename VertexId, typename WeightType>
+DistanceMatrix<WeightType> CsrGraph<VertexId, WeightType>::distance_matrix(std::span<const VertexId> sources,
+                                                                          size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot compute distances on empty graph");
+    }
+    require_non_negative_weights("Dijkstra's algorithm");
+
+    DistanceMatrix<WeightType> matrix;
+    matrix.vertex_count = vertex_count();
+    matrix.sources.reserve(sources.size());
+    for (const VertexId& source : sources) {
+        if (!has_vertex(source)) {
+            throw std::runtime_error("Start vertex does not exist in graph");
+        }
+        matrix.sources.push_back(index_of(source));
+    }
+    matrix.distances.assign(sources.size() * matrix.vertex_count, std::numeric_limits<WeightType>::max());
+
+    // Each row is written by exactly one worker; only the heap is worker-local scratch
+    using Entry = std::pair<WeightType, uint32_t>;
+    parallel_for(sources.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        std::vector<Entry> heap;
+        for (size_t row = begin; row < end; ++row) {
+            WeightType* distances = matrix.distances.data() + row * matrix.vertex_count;
+            uint32_t source = matrix.sources[row];
+
+            heap.clear();
+            distances[source] = 0;
+            heap.push_back({0, source});
+
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                auto [current_distance, current] = heap.back();
+                heap.pop_back();
+                if (current_distance > distances[current]) {
+                    continue;
+                }
+
+                for (size_t e = offsets_[current]; e < offsets_[current + 1]; ++e) {
+                    uint32_t neighbor = neighbors_[e];
+                    WeightType new_distance = current_distance + weights_[e];
+                    if (new_distance < distances[neighbor]) {
+                        distances[neighbor] = new_distance;
+                        heap.push_back({new_distance, neighbor});
+                        std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+                    }
+                }
+            }
+        }
+    });
+
+    return matrix;
+}
+
+
+template <typename VertexId, typename WeightType>
+DistanceMatrix<uint32_t> CsrGraph<VertexId, WeightType>::unweighted_distance_matrix(std::span<const VertexId> sources,
+                                                                                   size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot compute distances on empty graph");
+    }
+
+    const size_t n = vertex_count();
+    DistanceMatrix<uint32_t> matrix;
+    matrix.vertex_count = n;
+    matrix.sources.reserve(sources.size());
+    for (const VertexId& source : sources) {
+        if (!has_vertex(source)) {
+            throw std::runtime_error("Start vertex does not exist in graph");
+        }
+        matrix.sources.push_back(index_of(source));
+    }
+    matrix.distances.assign(sources.size() * n, std::numeric_limits<uint32_t>::max());
+
+    // Multi-source BFS (Then et al.): bit i of a word belongs to source i of the batch, so one
+    // neighbor scan advances up to 64 searches at once. Batches are independent and go to different workers
+    const size_t batch_count = (sources.size() + 63) / 64;
+    parallel_for(batch_count, thread_count, [&](size_t begin, size_t end, size_t) {
+        std::vector<uint64_t> seen(n);
+        std::vector<uint64_t> visit(n);
+        std::vector<uint64_t> visit_next(n);
+
+        for (size_t batch = begin; batch < end; ++batch) {
+            const size_t first_row = batch * 64;
+            const size_t rows = std::min<size_t>(64, sources.size() - first_row);
+
+            std::fill(seen.begin(), seen.end(), 0);
+            std::fill(visit.begin(), visit.end(), 0);
+            for (size_t i = 0; i < rows; ++i) {
+                uint32_t source = matrix.sources[first_row + i];
+                seen[source] |= uint64_t(1) << i;
+                visit[source] |= uint64_t(1) << i;
+                matrix.distances[(first_row + i) * n + source] = 0;
+            }
+
+            bool active = true;
+            for (uint32_t level = 1; active; ++level) {
+                std::fill(visit_next.begin(), visit_next.end(), 0);
+                for (uint32_t v = 0; v < n; ++v) {
+                    if (visit[v] == 0) {
+                        continue;
+                    }
+                    for (uint32_t neighbor : neighbors(v)) {
+                        visit_next[neighbor] |= visit[v];
+                    }
+                }
+
+                active = false;
+                for (uint32_t v = 0; v < n; ++v) {
+                    uint64_t discovered = visit_next[v] & ~seen[v];
+                    visit_next[v] = discovered;
+                    if (discovered == 0) {
+                        continue;
+                    }
+                    active = true;
+                    seen[v] |= discovered;
+                    while (discovered != 0) {
+                        size_t i = static_cast<size_t>(std::countr_zero(discovered));
+                        matrix.distances[(first_row + i) * n + v] = level;
+                        discovered &= discovered - 1;
+                    }
+                }
+                std::swap(visit, visit_next);
+            }
+        }
+    });
+
+    return matrix;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+template <typename DistanceType>
+DistanceTableResult<VertexId, DistanceType> Graph<VertexId, Resource, WeightType>::distance_table_ids(
+    std::span<const VertexId> sources, DistanceMatrix<DistanceType>&& matrix) const {
+    // Slots are the CSR indices, so the columns need no remapping
+    DistanceTableResult<VertexId, DistanceType> result;
+    result.sources.reserve(sources.size());
+    for (const VertexId& source : sources) {
+        result.sources.push_back(source);
+    }
+    result.vertices.reserve(slot_ids_.size());
+    for (const VertexId& id : slot_ids_) {
+        result.vertices.push_back(id);
+    }
+    result.matrix = std::move(matrix);
+    return result;
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+DistanceTableResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::distance_matrix(
+    std::span<const VertexId> sources, size_t thread_count) const {
+    return distance_table_ids(sources, freeze().distance_matrix(sources, thread_count));
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+DistanceTableResult<VertexId, uint32_t> Graph<VertexId, Resource, WeightType>::unweighted_distance_matrix(
+    std::span<const VertexId> sources, size_t thread_count) const {
+    return distance_table_ids(sources, freeze().unweighted_distance_matrix(sources, thread_count));
+}
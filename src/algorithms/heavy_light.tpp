@@ -0,0 +1,13 @@
+#include "../../include/graph.hpp"
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+HeavyLightDecomposition<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::heavy_light_decomposition() const {
+    return HeavyLightDecomposition<VertexId, WeightType>::build(freeze());
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+HeavyLightDecomposition<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::heavy_light_decomposition(
+        const VertexId& root) const {
+    return HeavyLightDecomposition<VertexId, WeightType>::build(freeze(), root);
+}
@@ -0,0 +1,12 @@
+#include "../../include/graph.hpp"
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+LcaIndex<VertexId> Graph<VertexId, Resource, WeightType>::lca_index() const {
+    return LcaIndex<VertexId>::build(freeze());
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+LcaIndex<VertexId> Graph<VertexId, Resource, WeightType>::lca_index(const VertexId& root) const {
+    return LcaIndex<VertexId>::build(freeze(), root);
+}
@@ -0,0 +1,530 @@
+#include "../../include/graph.hpp"
+#include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+template <typename VertexId, typename WeightType>
+std::vector<uint8_t> CsrGraph<VertexId, WeightType>::bipartite_sides() const {
+    constexpr uint8_t unset = 2;
+
+    std::vector<uint8_t> sides(vertex_count(), unset);
+    std::vector<uint32_t> queue;
+    for (uint32_t root = 0; root < vertex_count(); ++root) {
+        if (sides[root] != unset) {
+            continue;
+        }
+
+        sides[root] = 0;
+        queue.assign(1, root);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            uint32_t current = queue[head];
+            for (uint32_t neighbor : neighbors(current)) {
+                if (sides[neighbor] == unset) {
+                    sides[neighbor] = sides[current] ^ 1;
+                    queue.push_back(neighbor);
+                } else if (sides[neighbor] == sides[current]) {
+                    throw std::runtime_error("Graph is not bipartite");
+                }
+            }
+        }
+    }
+    return sides;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrMatching CsrGraph<VertexId, WeightType>::initial_matching() const {
+    constexpr uint32_t unmatched = CsrMatching::unmatched;
+
+    const size_t n = vertex_count();
+    CsrMatching matching;
+    matching.mates.assign(n, unmatched);
+    auto& mates = matching.mates;
+
+    // degrees[v] counts the unmatched neighbors of v; matching a degree one vertex to its only
+    // neighbor never makes the matching smaller than the maximum
+    std::vector<uint32_t> degrees(n, 0);
+    std::vector<uint32_t> pending;
+    for (uint32_t v = 0; v < n; ++v) {
+        for (uint32_t neighbor : neighbors(v)) {
+            degrees[v] += neighbor != v;
+        }
+        if (degrees[v] == 1) {
+            pending.push_back(v);
+        }
+    }
+
+    auto match_free_neighbor = [&](uint32_t u) {
+        for (uint32_t neighbor : neighbors(u)) {
+            if (neighbor != u && mates[neighbor] == unmatched) {
+                mates[u] = neighbor;
+                mates[neighbor] = u;
+                break;
+            }
+        }
+        ++matching.size;
+
+        for (uint32_t end : {u, mates[u]}) {
+            for (uint32_t neighbor : neighbors(end)) {
+                if (mates[neighbor] == unmatched && --degrees[neighbor] == 1) {
+                    pending.push_back(neighbor);
+                }
+            }
+        }
+    };
+
+    uint32_t next = 0;
+    while (true) {
+        if (!pending.empty()) {
+            uint32_t u = pending.back();
+            pending.pop_back();
+            if (mates[u] == unmatched && degrees[u] > 0) {
+                match_free_neighbor(u);
+            }
+            continue;
+        }
+
+        while (next < n && (mates[next] != unmatched || degrees[next] == 0)) {
+            ++next;
+        }
+        if (next == n) {
+            break;
+        }
+        match_free_neighbor(next);
+    }
+
+    return matching;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrMatching CsrGraph<VertexId, WeightType>::kuhn_matching() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find matching in empty graph");
+    }
+
+    constexpr uint32_t unmatched = CsrMatching::unmatched;
+
+    const std::vector<uint8_t> sides = bipartite_sides();
+    CsrMatching matching = initial_matching();
+    auto& mates = matching.mates;
+
+    // visited[r] == attempt marks right vertices seen since the last augmentation: a failed search
+    // leaves the matching as it was, so what it saw still leads nowhere for the next root
+    std::vector<uint32_t> visited(vertex_count(), 0);
+    std::vector<size_t> cursors(vertex_count());
+    std::vector<uint32_t> stack;
+    uint32_t attempt = 1;
+
+    for (uint32_t root = 0; root < vertex_count(); ++root) {
+        if (sides[root] != 0 || mates[root] != unmatched) {
+            continue;
+        }
+
+        stack.assign(1, root);
+        cursors[root] = offsets_[root];
+        while (!stack.empty()) {
+            uint32_t left = stack.back();
+            if (cursors[left] == offsets_[left + 1]) {
+                stack.pop_back();
+                continue;
+            }
+
+            uint32_t right = neighbors_[cursors[left]];
+            if (visited[right] == attempt) {
+                ++cursors[left];
+                continue;
+            }
+            visited[right] = attempt;
+
+            if (mates[right] != unmatched) {
+                uint32_t next = mates[right];
+                cursors[next] = offsets_[next];
+                stack.push_back(next);
+                continue;
+            }
+
+            // The stack is an alternating path ending in a free vertex: flip it
+            for (uint32_t on_path : stack) {
+                uint32_t through = neighbors_[cursors[on_path]];
+                mates[on_path] = through;
+                mates[through] = on_path;
+            }
+            ++matching.size;
+            ++attempt;
+            break;
+        }
+    }
+
+    return matching;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrMatching CsrGraph<VertexId, WeightType>::hopcroft_karp() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find matching in empty graph");
+    }
+
+    constexpr uint32_t unmatched = CsrMatching::unmatched;
+    constexpr uint32_t infinite = std::numeric_limits<uint32_t>::max();
+
+    const std::vector<uint8_t> sides = bipartite_sides();
+    CsrMatching matching = initial_matching();
+    auto& mates = matching.mates;
+
+    std::vector<uint32_t> free_left;
+    for (uint32_t v = 0; v < vertex_count(); ++v) {
+        if (sides[v] == 0 && mates[v] == unmatched && degree(v) > 0) {
+            free_left.push_back(v);
+        }
+    }
+
+    // layers[l] is the BFS depth of left vertex l in the alternating layered graph
+    std::vector<uint32_t> layers(vertex_count());
+    std::vector<size_t> cursors(vertex_count());
+    std::vector<uint32_t> queue;
+    std::vector<uint32_t> stack;
+
+    while (!free_left.empty()) {
+        std::fill(layers.begin(), layers.end(), infinite);
+        queue.clear();
+        for (uint32_t left : free_left) {
+            layers[left] = 0;
+            queue.push_back(left);
+        }
+
+        // Depth at which the shortest augmenting paths reach a free right vertex
+        uint32_t free_layer = infinite;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            uint32_t left = queue[head];
+            if (layers[left] >= free_layer) {
+                break;
+            }
+            for (uint32_t right : neighbors(left)) {
+                uint32_t next = mates[right];
+                if (next == unmatched) {
+                    free_layer = std::min(free_layer, layers[left] + 1);
+                } else if (layers[next] == infinite) {
+                    layers[next] = layers[left] + 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+        if (free_layer == infinite) {
+            break;
+        }
+
+        // Cursors survive between searches of a phase, so every edge is tried at most once per phase
+        for (uint32_t left : queue) {
+            cursors[left] = offsets_[left];
+        }
+
+        for (uint32_t root : free_left) {
+            stack.assign(1, root);
+            while (!stack.empty()) {
+                uint32_t left = stack.back();
+                if (cursors[left] == offsets_[left + 1]) {
+                    layers[left] = infinite; // dead end for the rest of the phase
+                    stack.pop_back();
+                    continue;
+                }
+
+                uint32_t right = neighbors_[cursors[left]];
+                uint32_t next = mates[right];
+                if (next == unmatched) {
+                    if (layers[left] + 1 != free_layer) {
+                        ++cursors[left];
+                        continue;
+                    }
+                    for (uint32_t on_path : stack) {
+                        uint32_t through = neighbors_[cursors[on_path]];
+                        mates[on_path] = through;
+                        mates[through] = on_path;
+                        layers[on_path] = infinite;
+                    }
+                    ++matching.size;
+                    break;
+                }
+
+                if (layers[next] != infinite && layers[next] == layers[left] + 1) {
+                    stack.push_back(next);
+                } else {
+                    ++cursors[left];
+                }
+            }
+        }
+
+        std::erase_if(free_left, [&mates](uint32_t left) { return mates[left] != unmatched; });
+    }
+
+    return matching;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrMatching CsrGraph<VertexId, WeightType>::parallel_matching(size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find matching in empty graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    constexpr uint32_t unmatched = CsrMatching::unmatched;
+
+    const std::vector<uint8_t> sides = bipartite_sides();
+    CsrMatching matching = initial_matching();
+    auto& mates = matching.mates;
+
+    const size_t n = vertex_count();
+    std::vector<uint32_t> free_left;
+    for (uint32_t v = 0; v < n; ++v) {
+        if (sides[v] == 0 && mates[v] == unmatched && degree(v) > 0) {
+            free_left.push_back(v);
+        }
+    }
+
+    // A right vertex belongs to the first search that stamps it with the current phase, which keeps
+    // the searches of a phase vertex-disjoint: only the owner of a right vertex reads or changes its
+    // mate, and only the owner of that mate changes the mate's cursor
+    std::vector<uint32_t> visited(n, 0);
+    std::vector<size_t> cursors(n);
+    // Matched vertices never become free again, so the search for a free neighbor resumes where it stopped
+    std::vector<size_t> lookahead(offsets_.begin(), offsets_.end() - 1);
+
+    struct Step {
+        uint32_t left;
+        uint32_t right;
+    };
+    std::vector<std::vector<Step>> stacks(thread_count);
+
+    // A phase in which no search succeeds proves the matching maximum
+    for (uint32_t phase = 1; !free_left.empty(); ++phase) {
+        std::atomic<size_t> augmented = 0;
+        parallel_for(free_left.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+            auto claim = [&](uint32_t right) {
+                return std::atomic_ref<uint32_t>(visited[right]).exchange(phase, std::memory_order_relaxed) != phase;
+            };
+            auto mate_of = [&](uint32_t vertex) {
+                return std::atomic_ref<uint32_t>(mates[vertex]).load(std::memory_order_relaxed);
+            };
+
+            auto& stack = stacks[worker];
+            size_t found = 0;
+            for (size_t i = begin; i < end; ++i) {
+                stack.assign(1, {free_left[i], unmatched});
+                cursors[free_left[i]] = offsets_[free_left[i]];
+
+                while (!stack.empty()) {
+                    Step& top = stack.back();
+                    const uint32_t left = top.left;
+
+                    uint32_t free_right = unmatched;
+                    while (lookahead[left] < offsets_[left + 1]) {
+                        uint32_t right = neighbors_[lookahead[left]++];
+                        if (mate_of(right) == unmatched && claim(right)) {
+                            free_right = right;
+                            break;
+                        }
+                    }
+
+                    if (free_right == unmatched) {
+                        while (cursors[left] < offsets_[left + 1]) {
+                            uint32_t right = neighbors_[cursors[left]++];
+                            if (claim(right)) {
+                                free_right = right;
+                                break;
+                            }
+                        }
+                        if (free_right == unmatched) {
+                            stack.pop_back();
+                            continue;
+                        }
+
+                        uint32_t next = mate_of(free_right);
+                        if (next != unmatched) {
+                            top.right = free_right;
+                            cursors[next] = offsets_[next];
+                            stack.push_back({next, unmatched});
+                            continue;
+                        }
+                    }
+
+                    top.right = free_right;
+                    for (const Step& step : stack) {
+                        std::atomic_ref<uint32_t>(mates[step.left]).store(step.right, std::memory_order_relaxed);
+                        std::atomic_ref<uint32_t>(mates[step.right]).store(step.left, std::memory_order_relaxed);
+                    }
+                    ++found;
+                    break;
+                }
+            }
+            augmented.fetch_add(found, std::memory_order_relaxed);
+        });
+
+        if (augmented == 0) {
+            break;
+        }
+        matching.size += augmented;
+        std::erase_if(free_left, [&mates](uint32_t left) { return mates[left] != unmatched; });
+    }
+
+    return matching;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrMatching CsrGraph<VertexId, WeightType>::edmonds_matching() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot find matching in empty graph");
+    }
+
+    constexpr uint32_t none = CsrMatching::unmatched;
+
+    const size_t n = vertex_count();
+    CsrMatching matching = initial_matching();
+    auto& mates = matching.mates;
+
+    // Alternating BFS forest from one root; an odd cycle (blossom) is contracted by pointing
+    // base[] of all its vertices at the cycle's base, which then acts as an even vertex
+    std::vector<uint32_t> parents(n);
+    std::vector<uint32_t> bases(n);
+    std::vector<bool> in_queue(n);
+    std::vector<bool> in_blossom(n);
+    std::vector<uint32_t> path_marks(n, 0);
+    std::vector<uint32_t> queue;
+    uint32_t mark = 0;
+
+    auto common_base = [&](uint32_t a, uint32_t b) {
+        ++mark;
+        while (true) {
+            a = bases[a];
+            path_marks[a] = mark;
+            if (mates[a] == none) {
+                break;
+            }
+            a = parents[mates[a]];
+        }
+        while (true) {
+            b = bases[b];
+            if (path_marks[b] == mark) {
+                return b;
+            }
+            b = parents[mates[b]];
+        }
+    };
+
+    auto mark_blossom = [&](uint32_t v, uint32_t base, uint32_t child) {
+        while (bases[v] != base) {
+            in_blossom[bases[v]] = true;
+            in_blossom[bases[mates[v]]] = true;
+            parents[v] = child;
+            child = mates[v];
+            v = parents[mates[v]];
+        }
+    };
+
+    // Free vertex at the end of an augmenting path from root, none if there is no such path
+    auto find_path = [&](uint32_t root) {
+        std::fill(parents.begin(), parents.end(), none);
+        std::fill(in_queue.begin(), in_queue.end(), false);
+        for (uint32_t v = 0; v < n; ++v) {
+            bases[v] = v;
+        }
+
+        in_queue[root] = true;
+        queue.assign(1, root);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            uint32_t current = queue[head];
+            for (uint32_t neighbor : neighbors(current)) {
+                if (bases[current] == bases[neighbor] || mates[current] == neighbor) {
+                    continue;
+                }
+
+                if (neighbor == root || (mates[neighbor] != none && parents[mates[neighbor]] != none)) {
+                    uint32_t base = common_base(current, neighbor);
+                    std::fill(in_blossom.begin(), in_blossom.end(), false);
+                    mark_blossom(current, base, neighbor);
+                    mark_blossom(neighbor, base, current);
+                    for (uint32_t v = 0; v < n; ++v) {
+                        if (in_blossom[bases[v]]) {
+                            bases[v] = base;
+                            if (!in_queue[v]) {
+                                in_queue[v] = true;
+                                queue.push_back(v);
+                            }
+                        }
+                    }
+                } else if (parents[neighbor] == none) {
+                    parents[neighbor] = current;
+                    if (mates[neighbor] == none) {
+                        return neighbor;
+                    }
+                    in_queue[mates[neighbor]] = true;
+                    queue.push_back(mates[neighbor]);
+                }
+            }
+        }
+        return none;
+    };
+
+    // A vertex without an augmenting path now never gets one later
+    for (uint32_t root = 0; root < n; ++root) {
+        if (mates[root] != none || degree(root) == 0) {
+            continue;
+        }
+
+        uint32_t end = find_path(root);
+        if (end == none) {
+            continue;
+        }
+        while (end != none) {
+            uint32_t previous = parents[end];
+            uint32_t next = mates[previous];
+            mates[end] = previous;
+            mates[previous] = end;
+            end = next;
+        }
+        ++matching.size;
+    }
+
+    return matching;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+MatchingResult<VertexId> Graph<VertexId, Resource, WeightType>::matching_ids(
+    const CsrGraph<VertexId, WeightType>& csr, const CsrMatching& matching) const {
+    MatchingResult<VertexId> result;
+    for (uint32_t v = 0; v < matching.mates.size(); ++v) {
+        if (matching.mates[v] != CsrMatching::unmatched && v < matching.mates[v]) {
+            result.pairs.push_back(std::make_pair(csr.id_of(v), csr.id_of(matching.mates[v])));
+        }
+    }
+    return result;
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+MatchingResult<VertexId> Graph<VertexId, Resource, WeightType>::kuhn_max_matching() const {
+    auto csr = freeze();
+    return matching_ids(csr, csr.kuhn_matching());
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+MatchingResult<VertexId> Graph<VertexId, Resource, WeightType>::hopcroft_karp() const {
+    auto csr = freeze();
+    return matching_ids(csr, csr.hopcroft_karp());
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+MatchingResult<VertexId> Graph<VertexId, Resource, WeightType>::edmonds_max_matching() const {
+    auto csr = freeze();
+    return matching_ids(csr, csr.edmonds_matching());
+}
@@ -0,0 +1,237 @@
+#include "../../include/graph.hpp"
+#include "../../include/priority_queues.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+PathResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::shortest_path(VertexId source,
+                                                                                     VertexId target) const {
+    Workspace forward;
+    Workspace backward;
+    return shortest_path(source, target, forward, backward);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+PathResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::shortest_path(VertexId source, VertexId target,
+                                                                                     Workspace& forward,
+                                                                                     Workspace& backward) const {
+    if (vertex_pool_.empty()) {
+        throw std::runtime_error("Cannot search for a path in empty graph");
+    }
+    if (!has_vertex(source) || !has_vertex(target)) {
+        throw std::runtime_error("Source or target vertex does not exist in graph");
+    }
+    if (&forward == &backward) {
+        throw std::runtime_error("Bidirectional search needs a separate workspace per direction");
+    }
+    // Checked up front, the search itself may never scan the negative edge
+    if (edge_arena_.negative_weight_count() > 0) {
+        throw std::runtime_error("Dijkstra's algorithm cannot handle negative weights");
+    }
+
+    PathResult<VertexId, WeightType> result;
+    if (source == target) {
+        result.path.push_back(source);
+        return result;
+    }
+
+    const WeightType infinity = std::numeric_limits<WeightType>::max();
+    const size_t slot_count = slot_ids_.size();
+
+    // Index 0 searches from the source, index 1 from the target; undirected edges serve both.
+    // Each side only touches the slots it reaches, so a query costs O(touched) and not O(V)
+    Workspace* workspaces[2] = {&forward, &backward};
+    BinaryHeap<WeightType>* queues[2];
+    uint32_t ends[2] = {slots_.at(source), slots_.at(target)};
+    for (int side = 0; side < 2; ++side) {
+        Workspace& workspace = *workspaces[side];
+        workspace.begin(slot_count);
+        queues[side] = &workspace.template queue<BinaryHeap<WeightType>>(slot_count, 0);
+
+        workspace.touch(ends[side]);
+        workspace.distances_[ends[side]] = 0;
+        queues[side]->push(ends[side], 0);
+    }
+
+    auto distance_of = [&](int side, uint32_t slot) {
+        return workspaces[side]->touched(slot) ? workspaces[side]->distances_[slot] : infinity;
+    };
+    auto is_settled = [&](int side, uint32_t slot) {
+        return workspaces[side]->touched(slot) && workspaces[side]->states_[slot] == 2;
+    };
+
+    // Best meeting found so far: forward reaches meet[0], backward reaches meet[1], joined by one edge
+    WeightType best = infinity;
+    uint32_t meet[2] = {0, 0};
+
+    auto top_distance = [&](int side) {
+        // Drop stale entries so the stopping rule sees real keys
+        while (!queues[side]->empty()) {
+            auto [distance, vertex] = queues[side]->top();
+            if (!is_settled(side, vertex) && distance <= distance_of(side, vertex)) {
+                return distance;
+            }
+            queues[side]->pop();
+        }
+        return infinity;
+    };
+
+    while (true) {
+        WeightType forward_top = top_distance(0);
+        WeightType backward_top = top_distance(1);
+        if (forward_top == infinity || backward_top == infinity) {
+            break;
+        }
+        // No unsettled pair can beat the best meeting any more
+        if (best != infinity && forward_top + backward_top >= best) {
+            break;
+        }
+
+        int side = forward_top <= backward_top ? 0 : 1;
+        Workspace& workspace = *workspaces[side];
+        auto [current_distance, current] = queues[side]->pop();
+        workspace.states_[current] = 2;
+        ++result.settled;
+
+        auto row = adjacency_list_.find(slot_ids_[current]);
+        if (row == adjacency_list_.end()) {
+            continue;
+        }
+
+        for (const auto& [_, edge_ptr] : row->second) {
+            uint32_t neighbor = edge_ptr->opposite_slot(current);
+            WeightType new_distance = current_distance + edge_ptr->get_weight();
+            workspace.touch(neighbor);
+            if (new_distance < workspace.distances_[neighbor]) {
+                workspace.distances_[neighbor] = new_distance;
+                workspace.previous_[neighbor] = current;
+                queues[side]->push(neighbor, new_distance);
+            }
+
+            WeightType other = distance_of(1 - side, neighbor);
+            if (other != infinity && new_distance + other < best) {
+                best = new_distance + other;
+                meet[side] = current;
+                meet[1 - side] = neighbor;
+            }
+        }
+    }
+
+    if (best == infinity) {
+        return result;
+    }
+
+    result.distance = best;
+    std::vector<uint32_t> forward_part;
+    for (uint32_t slot = meet[0]; ; slot = forward.previous_[slot]) {
+        forward_part.push_back(slot);
+        if (slot == ends[0]) {
+            break;
+        }
+    }
+    for (auto it = forward_part.rbegin(); it != forward_part.rend(); ++it) {
+        result.path.push_back(slot_ids_[*it]);
+    }
+    for (uint32_t slot = meet[1]; ; slot = backward.previous_[slot]) {
+        result.path.push_back(slot_ids_[slot]);
+        if (slot == ends[1]) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+template <typename Heuristic>
+PathResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::shortest_path(VertexId source, VertexId target,
+                                                                                     Heuristic heuristic) const {
+    Workspace workspace;
+    return shortest_path(source, target, heuristic, workspace);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+template <typename Heuristic>
+PathResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::shortest_path(VertexId source, VertexId target,
+                                                                                     Heuristic heuristic,
+                                                                                     Workspace& workspace) const {
+    if (vertex_pool_.empty()) {
+        throw std::runtime_error("Cannot search for a path in empty graph");
+    }
+    if (!has_vertex(source) || !has_vertex(target)) {
+        throw std::runtime_error("Source or target vertex does not exist in graph");
+    }
+    if (edge_arena_.negative_weight_count() > 0) {
+        throw std::runtime_error("A* cannot handle negative weights");
+    }
+
+    const size_t slot_count = slot_ids_.size();
+    workspace.begin(slot_count);
+    auto& distances = workspace.distances_;
+    auto& previous = workspace.previous_;
+    auto& states = workspace.states_; // 2 -> settled
+    // Keyed by distance + estimate; the real distance is looked up when an entry is popped
+    auto& queue = workspace.template queue<BinaryHeap<WeightType>>(slot_count, 0);
+
+    uint32_t start = slots_.at(source);
+    uint32_t goal = slots_.at(target);
+    workspace.touch(start);
+    distances[start] = 0;
+    queue.push(start, heuristic(source));
+
+    PathResult<VertexId, WeightType> result;
+    while (!queue.empty()) {
+        uint32_t current = queue.pop().second;
+        if (states[current] == 2) {
+            continue;
+        }
+        states[current] = 2;
+        ++result.settled;
+
+        if (current == goal) {
+            break;
+        }
+
+        auto row = adjacency_list_.find(slot_ids_[current]);
+        if (row == adjacency_list_.end()) {
+            continue;
+        }
+
+        for (const auto& [neighbor_id, edge_ptr] : row->second) {
+            uint32_t neighbor = edge_ptr->opposite_slot(current);
+            workspace.touch(neighbor);
+            if (states[neighbor] == 2) {
+                continue;
+            }
+            WeightType new_distance = distances[current] + edge_ptr->get_weight();
+            if (new_distance < distances[neighbor]) {
+                distances[neighbor] = new_distance;
+                previous[neighbor] = current;
+                queue.push(neighbor, new_distance + heuristic(neighbor_id));
+            }
+        }
+    }
+
+    if (!workspace.touched(goal) || states[goal] != 2) {
+        return result;
+    }
+
+    result.distance = distances[goal];
+    std::vector<uint32_t> reversed;
+    for (uint32_t slot = goal; slot != start; slot = previous[slot]) {
+        reversed.push_back(slot);
+    }
+    reversed.push_back(start);
+    for (auto it = reversed.rbegin(); it != reversed.rend(); ++it) {
+        result.path.push_back(slot_ids_[*it]);
+    }
+
+    return result;
+}
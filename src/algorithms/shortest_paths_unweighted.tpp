@@ -1,14 +1,30 @@
 #include "../../include/graph.hpp"
 #include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
-#include "../../dependencies/Data_Structures/Containers/Priority_Queue.hpp"
-#include "../../dependencies/Data_Structures/Containers/Queue.hpp"
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 template <typename VertexId, typename Resource, typename WeightType>
-void Graph<VertexId, Resource, WeightType>::shortest_paths_unweighted(VertexId start) {
+ShortestPathsResult<VertexId, size_t> Graph<VertexId, Resource, WeightType>::shortest_paths_unweighted(VertexId start) {
+    Workspace workspace;
+    ShortestPathsResult<VertexId, size_t> result = std::as_const(*this).shortest_paths_unweighted(start, workspace);
+
+    reset_parameters();
+    for (const auto& [id, _] : result.distances) {
+        vertex_pool_.at(id).set_color(2); // 2 -> Black 
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+ShortestPathsResult<VertexId, size_t> Graph<VertexId, Resource, WeightType>::shortest_paths_unweighted(
+        VertexId start, Workspace& workspace) const {
     if (vertex_pool_.empty()) {
         throw std::runtime_error("Cannot find shortest paths in empty graph");
     }
@@ -16,76 +32,69 @@ void Graph<VertexId, Resource, WeightType>::shortest_paths_unweighted(VertexId s
         throw std::runtime_error("Start vertex does not exist");
     }
 
-    reset_parameters();
+    workspace.begin(slot_ids_.size());
+    auto& distances = workspace.discovery_times_; // -1 means infinity 
+    auto& previous = workspace.previous_;
 
-    HashTable<VertexId, int> distances;
-    HashTable<VertexId, VertexId> previous;
-    
-    for (const auto& [vertex_id, _] : vertex_pool_) {
-        distances[vertex_id] = -1; // -1 means infinity 
-        previous[vertex_id] = vertex_id;
-    }
-    
-    Queue<VertexId> queue;
-    queue.enqueue(start);
-    distances[start] = 0;
-    vertex_pool_[start].set_color(1); // 1 -> Gray 
-
-    while (!queue.empty()) {
-        VertexId current = queue.front();
-        queue.dequeue();
-
-        for (const auto& [neighbor, _] : adjacency_list_[current]) {
-            if (distances[neighbor] == -1) { // unvisited vertex 
-                distances[neighbor] = distances[current] + 1;
-                previous[neighbor] = current;
-                queue.enqueue(neighbor);
-                vertex_pool_[neighbor].set_color(1);
+    // Discovery order doubles as the queue
+    auto& reached = workspace.order_;
+
+    uint32_t source = slots_.at(start);
+    workspace.touch(source);
+    distances[source] = 0;
+    reached.push_back(source);
+
+    for (size_t head = 0; head < reached.size(); ++head) {
+        uint32_t current = reached[head];
+
+        auto adj_it = adjacency_list_.find(slot_ids_[current]);
+        if (adj_it != adjacency_list_.end()) {
+            for (const auto& [_, edge_ptr] : adj_it->second) {
+                uint32_t neighbor = edge_ptr->opposite_slot(current);
+                if (!workspace.touched(neighbor)) { // unvisited vertex 
+                    workspace.touch(neighbor);
+                    distances[neighbor] = distances[current] + 1;
+                    previous[neighbor] = current;
+                    reached.push_back(neighbor);
+                }
             }
         }
-        vertex_pool_[current].set_color(2); // 2 -> Black 
     }
 
-    json result;
-    result["distances"] = json::object();
-    result["paths"] = json::object();
-
-    for (const auto& [vertex_id, distance] : distances) {
-        result["distances"][std::to_string(vertex_id)] = distance;
-    
-        size_t path_length = 0;
-        VertexId current = vertex_id;
-        
-        while (current != start && distances[current] != -1) {
-            path_length++;
-            current = previous[current];
-        }
-        
-        if (distances[vertex_id] != -1) {
-            path_length++; // adding start vertex 
-        }
+    ShortestPathsResult<VertexId, size_t> result;
+    result.start = start;
+    result.distances.reserve(reached.size());
+    result.previous.reserve(reached.size());
+
+    for (uint32_t slot : reached) {
+        const VertexId& id = slot_ids_[slot];
+        result.distances[id] = distances[slot];
+        result.previous[id] = slot_ids_[previous[slot]];
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::export_shortest_paths_unweighted(
+        const ShortestPathsResult<VertexId, size_t>& result) {
+    json data;
+    data["distances"] = json::object();
+    data["paths"] = json::object();
+
+    for (const auto& [vertex_id, _] : vertex_pool_) {
+        const std::string key = std::to_string(vertex_id);
+
+        auto it = result.distances.find(vertex_id);
+        data["distances"][key] = it == result.distances.end() ? -1 : static_cast<int>(it->second);
 
-        DynamicArray<VertexId> path(path_length);
-    
-        current = vertex_id;
-        size_t index = path_length - 1;
-        
-        while (current != start && distances[current] != -1) {
-            path[index--] = current;
-            current = previous[current];
-        }
-        
-        if (distances[vertex_id] != -1) {
-            path[0] = start;
-        }
-    
         json path_array = json::array();
-        
-        for (size_t i = 0; i < path_length; ++i) {
-            path_array.push_back(path[i]);
+        for (const auto& vertex : result.path_to(vertex_id)) {
+            path_array.push_back(vertex);
         }
-        result["paths"][std::to_string(vertex_id)] = path_array;
+        data["paths"][key] = path_array;
     }
 
-    save_json_to_file("shortest_paths_unweighted.json", result);
+    save_json_to_file("shortest_paths_unweighted.json", data);
 }
@@ -0,0 +1,294 @@
+#include "../../include/graph.hpp"
+#include "../../dependencies/Data_Structures/Containers/Dynamic_Array.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+template <typename VertexId, typename WeightType>
+CsrSpanningForest<WeightType> CsrGraph<VertexId, WeightType>::kruskal(size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot build spanning forest of empty graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    const size_t n = vertex_count();
+
+    // Every undirected edge is kept once, from its smaller end; first[v] is where v's edges go
+    std::vector<size_t> first(n + 1, 0);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            for (uint32_t neighbor : neighbors(static_cast<uint32_t>(v))) {
+                first[v + 1] += neighbor > v;
+            }
+        }
+    });
+    for (size_t v = 0; v < n; ++v) {
+        first[v + 1] += first[v];
+    }
+
+    // (weight, u, v) tuples sort in tie-breaking order as they are
+    std::vector<std::tuple<WeightType, uint32_t, uint32_t>> edges(first[n]);
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            size_t position = first[v];
+            for (size_t e = offsets_[v]; e < offsets_[v + 1]; ++e) {
+                if (neighbors_[e] > v) {
+                    edges[position++] = {weights_[e], static_cast<uint32_t>(v), neighbors_[e]};
+                }
+            }
+        }
+    });
+    parallel_sort(edges, std::less<std::tuple<WeightType, uint32_t, uint32_t>>(), thread_count);
+
+    CsrSpanningForest<WeightType> result;
+    DisjointSets sets(n);
+    for (const auto& [weight, u, v] : edges) {
+        if (sets.unite(u, v)) {
+            result.edges.emplace_back(u, v, weight);
+            result.total_weight += weight;
+            if (sets.set_count() == 1) {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrSpanningForest<WeightType> CsrGraph<VertexId, WeightType>::prim() const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot build spanning forest of empty graph");
+    }
+
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    const size_t n = vertex_count();
+    std::vector<WeightType> keys(n);
+    std::vector<uint32_t> parents(n, none);
+    std::vector<bool> in_tree(n, false);
+    IndexedFourAryHeap<WeightType> heap(n, 0);
+
+    CsrSpanningForest<WeightType> result;
+    for (uint32_t root = 0; root < n; ++root) {
+        if (in_tree[root]) {
+            continue;
+        }
+
+        heap.push(root, 0);
+        while (!heap.empty()) {
+            auto [key, current] = heap.pop();
+            in_tree[current] = true;
+            if (parents[current] != none) {
+                result.edges.emplace_back(std::min(parents[current], current),
+                                          std::max(parents[current], current), key);
+                result.total_weight += key;
+            }
+
+            for (size_t e = offsets_[current]; e < offsets_[current + 1]; ++e) {
+                uint32_t neighbor = neighbors_[e];
+                if (in_tree[neighbor] || (heap.contains(neighbor) && keys[neighbor] <= weights_[e])) {
+                    continue;
+                }
+                keys[neighbor] = weights_[e];
+                parents[neighbor] = current;
+                heap.push(neighbor, weights_[e]);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+CsrSpanningForest<WeightType> CsrGraph<VertexId, WeightType>::boruvka(size_t thread_count) const {
+    if (is_empty()) {
+        throw std::runtime_error("Cannot build spanning forest of empty graph");
+    }
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+    constexpr size_t no_edge = std::numeric_limits<size_t>::max();
+
+    const size_t n = vertex_count();
+
+    // Edge e leaves vertex source; the strict (weight, u, v) order makes every lightest edge unique,
+    // so hooking along them can't close a cycle
+    auto lighter = [this](uint32_t source_a, size_t a, uint32_t source_b, size_t b) {
+        uint32_t target_a = neighbors_[a];
+        uint32_t target_b = neighbors_[b];
+        return std::make_tuple(weights_[a], std::min(source_a, target_a), std::max(source_a, target_a)) <
+               std::make_tuple(weights_[b], std::min(source_b, target_b), std::max(source_b, target_b));
+    };
+
+    // Components are named by a root vertex; roots lists the ones that can still grow
+    std::vector<uint32_t> components(n);
+    std::vector<uint32_t> roots(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        components[v] = v;
+        roots[v] = v;
+    }
+
+    std::vector<size_t> lightest(n, no_edge);  // per vertex: lightest edge leaving its component
+    std::vector<uint32_t> best(n, none);      // per root: vertex holding the component's lightest edge
+    std::vector<uint32_t> targets(n);
+    std::vector<uint32_t> parents(n);
+    std::vector<uint32_t> jumped(n);
+    std::vector<std::vector<std::tuple<uint32_t, uint32_t, WeightType>>> chosen(thread_count);
+
+    while (!roots.empty()) {
+        parallel_for(roots.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                best[roots[i]] = none;
+            }
+        });
+
+        // Lock-free minimum per component: CAS the holder until no lighter candidate is left
+        parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t v = begin; v < end; ++v) {
+                const uint32_t source = static_cast<uint32_t>(v);
+                const uint32_t component = components[v];
+                size_t found = no_edge;
+                for (size_t e = offsets_[v]; e < offsets_[v + 1]; ++e) {
+                    if (components[neighbors_[e]] != component && (found == no_edge || lighter(source, e, source, found))) {
+                        found = e;
+                    }
+                }
+                lightest[v] = found;
+            }
+        });
+        parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t v = begin; v < end; ++v) {
+                if (lightest[v] == no_edge) {
+                    continue;
+                }
+                const uint32_t source = static_cast<uint32_t>(v);
+                std::atomic_ref<uint32_t> holder(best[components[v]]);
+                uint32_t current = holder.load(std::memory_order_relaxed);
+                while (current == none || lighter(source, lightest[v], current, lightest[current])) {
+                    if (holder.compare_exchange_weak(current, source, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+            }
+        });
+
+        parallel_for(roots.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t root = roots[i];
+                targets[root] = best[root] == none ? root : components[neighbors_[lightest[best[root]]]];
+            }
+        });
+
+        // Two components picking each other picked the same edge; the smaller one stays a root and keeps it
+        parallel_for(roots.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t root = roots[i];
+                uint32_t target = targets[root];
+                parents[root] = target;
+                if (target == root) {
+                    continue;
+                }
+                if (targets[target] == root) {
+                    if (root > target) {
+                        continue;
+                    }
+                    parents[root] = root;
+                }
+                uint32_t source = best[root];
+                size_t e = lightest[source];
+                chosen[worker].emplace_back(std::min(source, neighbors_[e]), std::max(source, neighbors_[e]), weights_[e]);
+            }
+        });
+
+        // Hooks can form long chains, so roots are found by pointer jumping in O(log V) steps
+        while (true) {
+            std::atomic<bool> changed = false;
+            parallel_for(roots.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+                bool local_changed = false;
+                for (size_t i = begin; i < end; ++i) {
+                    uint32_t root = roots[i];
+                    jumped[root] = parents[parents[root]];
+                    local_changed |= jumped[root] != parents[root];
+                }
+                if (local_changed) {
+                    changed.store(true, std::memory_order_relaxed);
+                }
+            });
+            if (!changed) {
+                break;
+            }
+            parallel_for(roots.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                    parents[roots[i]] = jumped[roots[i]];
+                }
+            });
+        }
+
+        parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t v = begin; v < end; ++v) {
+                components[v] = parents[components[v]];
+            }
+        });
+
+        // A component without an outgoing edge is finished
+        std::erase_if(roots, [&](uint32_t root) { return parents[root] != root || best[root] == none; });
+    }
+
+    CsrSpanningForest<WeightType> result;
+    for (auto& edges : chosen) {
+        result.edges.insert(result.edges.end(), edges.begin(), edges.end());
+    }
+    parallel_sort(result.edges, [](const auto& a, const auto& b) {
+        return std::tie(std::get<2>(a), std::get<0>(a), std::get<1>(a)) <
+               std::tie(std::get<2>(b), std::get<0>(b), std::get<1>(b));
+    }, thread_count);
+    for (const auto& edge : result.edges) {
+        result.total_weight += std::get<2>(edge);
+    }
+
+    return result;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+SpanningForestResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::spanning_forest_ids(
+    const CsrGraph<VertexId, WeightType>& csr, const CsrSpanningForest<WeightType>& forest) const {
+    SpanningForestResult<VertexId, WeightType> result;
+    result.total_weight = forest.total_weight;
+    for (const auto& [u, v, weight] : forest.edges) {
+        result.edges.push_back(std::make_tuple(csr.id_of(u), csr.id_of(v), weight));
+    }
+    return result;
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+SpanningForestResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::kruskal(size_t thread_count) const {
+    auto csr = freeze();
+    return spanning_forest_ids(csr, csr.kruskal(thread_count));
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+SpanningForestResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::prim() const {
+    auto csr = freeze();
+    return spanning_forest_ids(csr, csr.prim());
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+SpanningForestResult<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::boruvka(size_t thread_count) const {
+    auto csr = freeze();
+    return spanning_forest_ids(csr, csr.boruvka(thread_count));
+}
@@ -0,0 +1,535 @@
+#include "../include/contraction_hierarchy.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+template <typename VertexId, typename WeightType>
+ContractionHierarchy<VertexId, WeightType> ContractionHierarchy<VertexId, WeightType>::build(
+        const CsrGraph<VertexId, WeightType>& graph) {
+    for (const WeightType& weight : graph.get_weights()) {
+        if (weight < 0) {
+            throw std::runtime_error("Contraction hierarchies cannot handle negative weights");
+        }
+    }
+
+    // Witness searches give up after this many settled vertices and then assume a shortcut is needed;
+    // priority estimation uses the cheaper limit
+    constexpr size_t contract_settle_limit = 500;
+    constexpr size_t simulate_settle_limit = 50;
+
+    const uint32_t n = static_cast<uint32_t>(graph.vertex_count());
+
+    struct Arc {
+        uint32_t target;
+        WeightType weight;
+        uint32_t middle;
+    };
+
+    // Remaining graph: contracted vertices are erased from their neighbors' lists
+    std::vector<std::vector<Arc>> adjacency(n);
+    for (uint32_t v = 0; v < n; ++v) {
+        auto neighbors = graph.neighbors(v);
+        auto weights = graph.weights(v);
+        adjacency[v].reserve(neighbors.size());
+        for (size_t k = 0; k < neighbors.size(); ++k) {
+            adjacency[v].push_back({neighbors[k], weights[k], no_middle});
+        }
+    }
+
+    std::vector<uint32_t> deleted_neighbors(n, 0);
+
+    std::vector<WeightType> witness_distance(n);
+    std::vector<uint32_t> witness_stamp(n, 0);
+    uint32_t witness_epoch = 0;
+    using Entry = std::pair<WeightType, uint32_t>;
+    std::vector<Entry> witness_heap;
+
+    // Targets of the running witness search; it stops early once all of them are settled
+    std::vector<uint8_t> is_target(n, 0);
+    size_t targets_left = 0;
+
+    auto witness_search = [&](uint32_t source, uint32_t skipped, WeightType limit, size_t settle_limit) {
+        ++witness_epoch;
+        witness_heap.clear();
+        witness_distance[source] = 0;
+        witness_stamp[source] = witness_epoch;
+        witness_heap.push_back({0, source});
+
+        size_t settled = 0;
+        while (!witness_heap.empty() && settled < settle_limit) {
+            std::pop_heap(witness_heap.begin(), witness_heap.end(), std::greater<Entry>());
+            auto [distance, u] = witness_heap.back();
+            witness_heap.pop_back();
+            if (distance > witness_distance[u]) {
+                continue;
+            }
+            if (distance > limit) {
+                break;
+            }
+            ++settled;
+            if (is_target[u] && --targets_left == 0) {
+                break;
+            }
+
+            for (const Arc& arc : adjacency[u]) {
+                if (arc.target == skipped) {
+                    continue;
+                }
+                WeightType new_distance = distance + arc.weight;
+                if (witness_stamp[arc.target] != witness_epoch || new_distance < witness_distance[arc.target]) {
+                    witness_stamp[arc.target] = witness_epoch;
+                    witness_distance[arc.target] = new_distance;
+                    witness_heap.push_back({new_distance, arc.target});
+                    std::push_heap(witness_heap.begin(), witness_heap.end(), std::greater<Entry>());
+                }
+            }
+        }
+    };
+
+    auto add_shortcut = [&](uint32_t from, uint32_t to, WeightType weight, uint32_t middle) {
+        for (auto [a, b] : {std::pair{from, to}, std::pair{to, from}}) {
+            auto it = std::find_if(adjacency[a].begin(), adjacency[a].end(),
+                [b](const Arc& arc) { return arc.target == b; });
+            if (it == adjacency[a].end()) {
+                adjacency[a].push_back({b, weight, middle});
+            } else if (weight < it->weight) {
+                it->weight = weight;
+                it->middle = middle;
+            }
+        }
+    };
+
+    // A shortcut u - w is needed unless a path avoiding v is at most as long as u - v - w
+    auto contract = [&](uint32_t v, bool simulate) {
+        const auto& arcs = adjacency[v];
+
+        size_t shortcuts = 0;
+        for (size_t i = 0; i + 1 < arcs.size(); ++i) {
+            const Arc in = arcs[i];
+            WeightType max_weight = 0;
+            targets_left = arcs.size() - i - 1;
+            for (size_t j = i + 1; j < arcs.size(); ++j) {
+                is_target[arcs[j].target] = 1;
+                max_weight = std::max(max_weight, arcs[j].weight);
+            }
+            witness_search(in.target, v, in.weight + max_weight,
+                           simulate ? simulate_settle_limit : contract_settle_limit);
+            for (size_t j = i + 1; j < arcs.size(); ++j) {
+                is_target[arcs[j].target] = 0;
+            }
+
+            for (size_t j = i + 1; j < arcs.size(); ++j) {
+                const Arc out = arcs[j];
+                WeightType via = in.weight + out.weight;
+                if (witness_stamp[out.target] == witness_epoch && witness_distance[out.target] <= via) {
+                    continue;
+                }
+                ++shortcuts;
+                if (!simulate) {
+                    add_shortcut(in.target, out.target, via, v);
+                }
+            }
+        }
+        return shortcuts;
+    };
+
+    auto priority = [&](uint32_t v) {
+        int64_t edge_difference = static_cast<int64_t>(contract(v, true)) - static_cast<int64_t>(adjacency[v].size());
+        return edge_difference + static_cast<int64_t>(deleted_neighbors[v]);
+    };
+
+    ContractionHierarchy hierarchy;
+    hierarchy.vertex_ids_.assign(graph.get_vertex_ids().begin(), graph.get_vertex_ids().end());
+    hierarchy.rank_.assign(n, 0);
+
+    std::vector<std::tuple<uint32_t, uint32_t, WeightType, uint32_t>> upward; // from, to, weight, middle
+
+    using Candidate = std::pair<int64_t, uint32_t>;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> order;
+    for (uint32_t v = 0; v < n; ++v) {
+        order.push({priority(v), v});
+    }
+
+    uint32_t next_rank = 0;
+    while (!order.empty()) {
+        uint32_t v = order.top().second;
+        order.pop();
+
+        // Priorities go stale as neighbors get contracted; recheck before committing (lazy updates)
+        int64_t current = priority(v);
+        if (!order.empty() && current > order.top().first) {
+            order.push({current, v});
+            continue;
+        }
+
+        contract(v, false);
+        for (const Arc& arc : adjacency[v]) {
+            upward.emplace_back(v, arc.target, arc.weight, arc.middle);
+            auto& row = adjacency[arc.target];
+            row.erase(std::find_if(row.begin(), row.end(), [v](const Arc& back) { return back.target == v; }));
+            ++deleted_neighbors[arc.target];
+        }
+        adjacency[v].clear();
+        adjacency[v].shrink_to_fit();
+        hierarchy.rank_[v] = next_rank++;
+    }
+
+    hierarchy.up_offsets_.assign(n + 1, 0);
+    for (const auto& edge : upward) {
+        ++hierarchy.up_offsets_[std::get<0>(edge) + 1];
+    }
+    for (uint32_t v = 0; v < n; ++v) {
+        hierarchy.up_offsets_[v + 1] += hierarchy.up_offsets_[v];
+    }
+
+    hierarchy.up_targets_.resize(upward.size());
+    hierarchy.up_weights_.resize(upward.size());
+    hierarchy.up_middles_.resize(upward.size());
+    std::vector<size_t> cursor(hierarchy.up_offsets_.begin(), hierarchy.up_offsets_.end() - 1);
+    for (const auto& [from, to, weight, middle] : upward) {
+        size_t position = cursor[from]++;
+        hierarchy.up_targets_[position] = to;
+        hierarchy.up_weights_[position] = weight;
+        hierarchy.up_middles_[position] = middle;
+        if (middle != no_middle) {
+            ++hierarchy.shortcut_count_;
+        }
+    }
+
+    hierarchy.build_index();
+    return hierarchy;
+}
+
+template <typename VertexId, typename WeightType>
+template <typename Resource>
+ContractionHierarchy<VertexId, WeightType> ContractionHierarchy<VertexId, WeightType>::build(
+        const Graph<VertexId, Resource, WeightType>& graph) {
+    return build(graph.freeze());
+}
+
+template <typename VertexId, typename WeightType>
+void ContractionHierarchy<VertexId, WeightType>::build_index() {
+    index_.clear();
+    index_.reserve(vertex_ids_.size());
+    for (uint32_t i = 0; i < vertex_ids_.size(); ++i) {
+        index_[vertex_ids_[i]] = i;
+    }
+}
+
+template <typename VertexId, typename WeightType>
+uint32_t ContractionHierarchy<VertexId, WeightType>::rank_of(const VertexId& id) const {
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return rank_[it->second];
+}
+
+template <typename VertexId, typename WeightType>
+uint32_t ContractionHierarchy<VertexId, WeightType>::middle_of(uint32_t a, uint32_t b) const {
+    uint32_t low = rank_[a] < rank_[b] ? a : b;
+    uint32_t high = low == a ? b : a;
+    for (size_t e = up_offsets_[low]; e < up_offsets_[low + 1]; ++e) {
+        if (up_targets_[e] == high) {
+            return up_middles_[e];
+        }
+    }
+    throw std::logic_error("Vertices are not adjacent in the hierarchy");
+}
+
+template <typename VertexId, typename WeightType>
+WeightType ContractionHierarchy<VertexId, WeightType>::distance(const VertexId& source, const VertexId& target) const {
+    Query query(*this);
+    return query.distance(source, target);
+}
+
+template <typename VertexId, typename WeightType>
+PathResult<VertexId, WeightType> ContractionHierarchy<VertexId, WeightType>::shortest_path(
+        const VertexId& source, const VertexId& target) const {
+    Query query(*this);
+    return query.shortest_path(source, target);
+}
+
+
+template <typename VertexId, typename WeightType>
+ContractionHierarchy<VertexId, WeightType>::Query::Query(const ContractionHierarchy& hierarchy) :
+    hierarchy_(&hierarchy) {
+    for (int side = 0; side < 2; ++side) {
+        distances_[side].resize(hierarchy.vertex_count());
+        parents_[side].resize(hierarchy.vertex_count());
+        stamps_[side].assign(hierarchy.vertex_count(), 0);
+    }
+}
+
+template <typename VertexId, typename WeightType>
+std::pair<WeightType, uint32_t> ContractionHierarchy<VertexId, WeightType>::Query::search(uint32_t source,
+                                                                                         uint32_t target) {
+    const WeightType infinity = std::numeric_limits<WeightType>::max();
+    if (++epoch_ == 0) {
+        for (auto& stamps : stamps_) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+        }
+        epoch_ = 1;
+    }
+
+    auto distance_of = [&](int side, uint32_t v) {
+        return stamps_[side][v] == epoch_ ? distances_[side][v] : infinity;
+    };
+
+    using Entry = std::pair<WeightType, uint32_t>;
+    auto& heaps = heaps_;
+    uint32_t ends[2] = {source, target};
+    settled_ = 0;
+    for (int side = 0; side < 2; ++side) {
+        distances_[side][ends[side]] = 0;
+        parents_[side][ends[side]] = ends[side];
+        stamps_[side][ends[side]] = epoch_;
+        heaps[side].clear();
+        heaps[side].push_back({0, ends[side]});
+    }
+
+    WeightType best = infinity;
+    uint32_t meet = source;
+
+    while (true) {
+        WeightType tops[2];
+        for (int side = 0; side < 2; ++side) {
+            tops[side] = heaps[side].empty() ? infinity : heaps[side].front().first;
+        }
+        // Each side can stop once its smallest key cannot improve the best meeting
+        if ((tops[0] == infinity || tops[0] >= best) && (tops[1] == infinity || tops[1] >= best)) {
+            break;
+        }
+
+        int side = tops[0] <= tops[1] ? 0 : 1;
+        std::pop_heap(heaps[side].begin(), heaps[side].end(), std::greater<Entry>());
+        auto [distance, u] = heaps[side].back();
+        heaps[side].pop_back();
+        if (distance > distance_of(side, u)) {
+            continue;
+        }
+        ++settled_;
+
+        WeightType other = distance_of(1 - side, u);
+        if (other != infinity && distance + other < best) {
+            best = distance + other;
+            meet = u;
+        }
+
+        const auto& h = *hierarchy_;
+        for (size_t e = h.up_offsets_[u]; e < h.up_offsets_[u + 1]; ++e) {
+            uint32_t v = h.up_targets_[e];
+            WeightType new_distance = distance + h.up_weights_[e];
+            if (new_distance < distance_of(side, v)) {
+                distances_[side][v] = new_distance;
+                parents_[side][v] = u;
+                stamps_[side][v] = epoch_;
+                heaps[side].push_back({new_distance, v});
+                std::push_heap(heaps[side].begin(), heaps[side].end(), std::greater<Entry>());
+            }
+        }
+    }
+
+    return {best, meet};
+}
+
+template <typename VertexId, typename WeightType>
+WeightType ContractionHierarchy<VertexId, WeightType>::Query::distance(const VertexId& source, const VertexId& target) {
+    auto source_it = hierarchy_->index_.find(source);
+    auto target_it = hierarchy_->index_.find(target);
+    if (source_it == hierarchy_->index_.end() || target_it == hierarchy_->index_.end()) {
+        throw std::runtime_error("Source or target vertex does not exist in graph");
+    }
+    return search(source_it->second, target_it->second).first;
+}
+
+template <typename VertexId, typename WeightType>
+PathResult<VertexId, WeightType> ContractionHierarchy<VertexId, WeightType>::Query::shortest_path(
+        const VertexId& source, const VertexId& target) {
+    auto source_it = hierarchy_->index_.find(source);
+    auto target_it = hierarchy_->index_.find(target);
+    if (source_it == hierarchy_->index_.end() || target_it == hierarchy_->index_.end()) {
+        throw std::runtime_error("Source or target vertex does not exist in graph");
+    }
+    uint32_t s = source_it->second;
+    uint32_t t = target_it->second;
+
+    PathResult<VertexId, WeightType> result;
+    auto [best, meet] = search(s, t);
+    if (best == std::numeric_limits<WeightType>::max()) {
+        return result;
+    }
+    result.distance = best;
+
+    // Hierarchy path s .. meet .. t, every hop of which may be a shortcut
+    std::vector<uint32_t> hops;
+    for (uint32_t v = meet; v != s; v = parents_[0][v]) {
+        hops.push_back(v);
+    }
+    hops.push_back(s);
+    std::reverse(hops.begin(), hops.end());
+    for (uint32_t v = meet; v != t; ) {
+        v = parents_[1][v];
+        hops.push_back(v);
+    }
+
+    const auto& h = *hierarchy_;
+    result.path.push_back(h.vertex_ids_[s]);
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    for (size_t i = 0; i + 1 < hops.size(); ++i) {
+        stack.push_back({hops[i], hops[i + 1]});
+        while (!stack.empty()) {
+            auto [a, b] = stack.back();
+            stack.pop_back();
+            uint32_t middle = h.middle_of(a, b);
+            if (middle == no_middle) {
+                result.path.push_back(h.vertex_ids_[b]);
+            } else {
+                // Second half goes first on the stack so the first half is unpacked first
+                stack.push_back({middle, b});
+                stack.push_back({a, middle});
+            }
+        }
+    }
+    result.settled = settled_;
+
+    return result;
+}
+
+
+template <typename VertexId, typename WeightType>
+void ContractionHierarchy<VertexId, WeightType>::save(const std::string& filename) const {
+    static_assert(std::is_trivially_copyable_v<VertexId> && std::is_trivially_copyable_v<WeightType>,
+                  "Binary format requires trivially copyable vertex ids and weights");
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file for writing");
+    }
+
+    auto write = [&file](const void* data, size_t bytes) {
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+
+    const char magic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'H', 0};
+    const uint32_t header[4] = {1, GraphFileHeader::byte_order_mark, sizeof(VertexId), sizeof(WeightType)};
+    const uint64_t counts[3] = {vertex_ids_.size(), up_targets_.size(), shortcut_count_};
+    write(magic, sizeof(magic));
+    write(header, sizeof(header));
+    write(counts, sizeof(counts));
+
+    write(vertex_ids_.data(), vertex_ids_.size() * sizeof(VertexId));
+    write(rank_.data(), rank_.size() * sizeof(uint32_t));
+    write(up_offsets_.data(), up_offsets_.size() * sizeof(size_t));
+    write(up_targets_.data(), up_targets_.size() * sizeof(uint32_t));
+    write(up_weights_.data(), up_weights_.size() * sizeof(WeightType));
+    write(up_middles_.data(), up_middles_.size() * sizeof(uint32_t));
+
+    if (!file) {
+        throw std::runtime_error("Failed to write contraction hierarchy");
+    }
+}
+
+template <typename VertexId, typename WeightType>
+ContractionHierarchy<VertexId, WeightType> ContractionHierarchy<VertexId, WeightType>::load(const std::string& filename) {
+    static_assert(std::is_trivially_copyable_v<VertexId> && std::is_trivially_copyable_v<WeightType>,
+                  "Binary format requires trivially copyable vertex ids and weights");
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file for reading");
+    }
+
+    auto read = [&file](void* data, size_t bytes) {
+        file.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+        if (!file) {
+            throw std::runtime_error("Malformed contraction hierarchy file: truncated");
+        }
+    };
+
+    file.seekg(0, std::ios::end);
+    const uint64_t file_size = static_cast<uint64_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    char magic[8];
+    uint32_t header[4];
+    uint64_t counts[3];
+    read(magic, sizeof(magic));
+    read(header, sizeof(header));
+    read(counts, sizeof(counts));
+
+    const char expected_magic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'H', 0};
+    if (std::memcmp(magic, expected_magic, sizeof(magic)) != 0 || header[0] != 1 ||
+        header[1] != GraphFileHeader::byte_order_mark) {
+        throw std::runtime_error("Malformed contraction hierarchy file");
+    }
+    if (header[2] != sizeof(VertexId) || header[3] != sizeof(WeightType)) {
+        throw std::runtime_error("Contraction hierarchy types do not match the requested types");
+    }
+
+    // Counts are bounded by what the rest of the file can hold before anything is allocated or
+    // multiplied, so a crafted header can neither force a huge allocation nor wrap a length around
+    const uint64_t remaining = file_size - (sizeof(magic) + sizeof(header) + sizeof(counts));
+    const uint64_t vertex_bytes = sizeof(VertexId) + sizeof(uint32_t) + sizeof(size_t);
+    const uint64_t entry_bytes = sizeof(uint32_t) + sizeof(WeightType) + sizeof(uint32_t);
+    if (remaining < sizeof(size_t) || counts[0] >= no_middle ||
+        counts[0] > (remaining - sizeof(size_t)) / vertex_bytes ||
+        counts[1] != (remaining - sizeof(size_t) - counts[0] * vertex_bytes) / entry_bytes ||
+        counts[2] > counts[1]) {
+        throw std::runtime_error("Malformed contraction hierarchy file: bad counts");
+    }
+
+    ContractionHierarchy hierarchy;
+    hierarchy.vertex_ids_.resize(counts[0]);
+    hierarchy.rank_.resize(counts[0]);
+    hierarchy.up_offsets_.resize(counts[0] + 1);
+    hierarchy.up_targets_.resize(counts[1]);
+    hierarchy.up_weights_.resize(counts[1]);
+    hierarchy.up_middles_.resize(counts[1]);
+    hierarchy.shortcut_count_ = counts[2];
+
+    read(hierarchy.vertex_ids_.data(), counts[0] * sizeof(VertexId));
+    read(hierarchy.rank_.data(), counts[0] * sizeof(uint32_t));
+    read(hierarchy.up_offsets_.data(), (counts[0] + 1) * sizeof(size_t));
+    read(hierarchy.up_targets_.data(), counts[1] * sizeof(uint32_t));
+    read(hierarchy.up_weights_.data(), counts[1] * sizeof(WeightType));
+    read(hierarchy.up_middles_.data(), counts[1] * sizeof(uint32_t));
+
+    if (hierarchy.up_offsets_.front() != 0 || hierarchy.up_offsets_.back() != counts[1]) {
+        throw std::runtime_error("Malformed contraction hierarchy file: inconsistent offsets");
+    }
+
+    // Queries index by these without checks. Ranks have to be a permutation, edges lead upwards and
+    // shortcuts skip a lower ranked vertex, which also keeps path unpacking from looping
+    const uint32_t n = static_cast<uint32_t>(counts[0]);
+    std::vector<uint8_t> rank_taken(n, 0);
+    for (uint32_t rank : hierarchy.rank_) {
+        if (rank >= n || rank_taken[rank]) {
+            throw std::runtime_error("Malformed contraction hierarchy file: ranks are not a permutation");
+        }
+        rank_taken[rank] = 1;
+    }
+    for (uint32_t v = 0; v < n; ++v) {
+        if (hierarchy.up_offsets_[v] > hierarchy.up_offsets_[v + 1]) {
+            throw std::runtime_error("Malformed contraction hierarchy file: inconsistent offsets");
+        }
+        for (size_t e = hierarchy.up_offsets_[v]; e < hierarchy.up_offsets_[v + 1]; ++e) {
+            uint32_t target = hierarchy.up_targets_[e];
+            uint32_t middle = hierarchy.up_middles_[e];
+            if (target >= n || hierarchy.rank_[target] <= hierarchy.rank_[v] ||
+                (middle != no_middle && (middle >= n || hierarchy.rank_[middle] >= hierarchy.rank_[v]))) {
+                throw std::runtime_error("Malformed contraction hierarchy file: edge out of range");
+            }
+        }
+    }
+
+    hierarchy.build_index();
+    return hierarchy;
+}
@@ -0,0 +1,20 @@
+#include "../include/counting_sort.hpp"
+
+
+template <typename Key>
+void counting_sort_descending(std::vector<uint32_t>& vertices, size_t max_key, Key key) {
+    // next[k] is where the next vertex with key k goes; larger keys come first
+    std::vector<size_t> next(max_key + 2, 0);
+    for (uint32_t vertex : vertices) {
+        ++next[max_key - key(vertex) + 1];
+    }
+    for (size_t k = 1; k < next.size(); ++k) {
+        next[k] += next[k - 1];
+    }
+
+    std::vector<uint32_t> sorted(vertices.size());
+    for (uint32_t vertex : vertices) {
+        sorted[next[max_key - key(vertex)]++] = vertex;
+    }
+    vertices.swap(sorted);
+}
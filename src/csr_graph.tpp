@@ -0,0 +1,477 @@
+#include "../include/csr_graph.hpp"
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType>::CsrGraph() : offsets_storage_(1, 0) {
+    bind_storage();
+}
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType>::CsrGraph(std::vector<VertexId> vertex_ids, std::vector<size_t> offsets,
+                                         std::vector<uint32_t> neighbors, std::vector<WeightType> weights) :
+    offsets_storage_(std::move(offsets)),
+    neighbors_storage_(std::move(neighbors)),
+    weights_storage_(std::move(weights)),
+    vertex_ids_storage_(std::move(vertex_ids)) {
+
+    if (offsets_storage_.size() != vertex_ids_storage_.size() + 1 ||
+        offsets_storage_.back() != neighbors_storage_.size() ||
+        neighbors_storage_.size() != weights_storage_.size()) {
+        throw std::invalid_argument("Inconsistent CSR arrays");
+    }
+
+    bind_storage();
+    build_index();
+}
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType>::CsrGraph(const CsrGraph& other) :
+    offsets_storage_(other.offsets_storage_),
+    neighbors_storage_(other.neighbors_storage_),
+    weights_storage_(other.weights_storage_),
+    vertex_ids_storage_(other.vertex_ids_storage_),
+    mapping_(other.mapping_),
+    offsets_(other.offsets_),
+    neighbors_(other.neighbors_),
+    weights_(other.weights_),
+    vertex_ids_(other.vertex_ids_),
+    payload_flags_(other.payload_flags_),
+    payloads_(other.payloads_),
+    payload_size_(other.payload_size_),
+    sorted_ids_(other.sorted_ids_),
+    index_(other.index_) {
+
+    // A mapping is shared between copies, owned storage has to be re-pointed
+    if (!mapping_) {
+        bind_storage();
+    }
+}
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType>& CsrGraph<VertexId, WeightType>::operator=(const CsrGraph& other) {
+    if (this != &other) {
+        CsrGraph copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::bind_storage() {
+    offsets_ = offsets_storage_;
+    neighbors_ = neighbors_storage_;
+    weights_ = weights_storage_;
+    vertex_ids_ = vertex_ids_storage_;
+}
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::build_index() {
+    if constexpr (std::totally_ordered<VertexId>) {
+        sorted_ids_ = std::adjacent_find(vertex_ids_.begin(), vertex_ids_.end(),
+            [](const VertexId& a, const VertexId& b) { return !(a < b); }) == vertex_ids_.end();
+        if (sorted_ids_) {
+            return;
+        }
+    }
+
+    index_.reserve(vertex_ids_.size());
+    for (uint32_t i = 0; i < vertex_ids_.size(); ++i) {
+        index_[vertex_ids_[i]] = i;
+    }
+}
+
+template <typename VertexId, typename WeightType>
+size_t CsrGraph<VertexId, WeightType>::vertex_count() const noexcept {
+    return vertex_ids_.size();
+}
+
+template <typename VertexId, typename WeightType>
+size_t CsrGraph<VertexId, WeightType>::edge_count() const noexcept {
+    return neighbors_.size() / 2;
+}
+
+template <typename VertexId, typename WeightType>
+bool CsrGraph<VertexId, WeightType>::is_empty() const noexcept {
+    return vertex_ids_.empty();
+}
+
+template <typename VertexId, typename WeightType>
+bool CsrGraph<VertexId, WeightType>::has_vertex(const VertexId& id) const {
+    if constexpr (std::totally_ordered<VertexId>) {
+        if (sorted_ids_) {
+            return std::binary_search(vertex_ids_.begin(), vertex_ids_.end(), id);
+        }
+    }
+    return index_.find(id) != index_.end();
+}
+
+template <typename VertexId, typename WeightType>
+uint32_t CsrGraph<VertexId, WeightType>::index_of(const VertexId& id) const {
+    if constexpr (std::totally_ordered<VertexId>) {
+        if (sorted_ids_) {
+            auto it = std::lower_bound(vertex_ids_.begin(), vertex_ids_.end(), id);
+            if (it == vertex_ids_.end() || *it != id) {
+                throw std::invalid_argument("Vertex does not exist");
+            }
+            return static_cast<uint32_t>(it - vertex_ids_.begin());
+        }
+    }
+
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename VertexId, typename WeightType>
+const VertexId& CsrGraph<VertexId, WeightType>::id_of(uint32_t index) const {
+    if (index >= vertex_ids_.size()) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+    return vertex_ids_[index];
+}
+
+template <typename VertexId, typename WeightType>
+size_t CsrGraph<VertexId, WeightType>::degree(uint32_t index) const {
+    return offsets_[index + 1] - offsets_[index];
+}
+
+template <typename VertexId, typename WeightType>
+size_t CsrGraph<VertexId, WeightType>::max_degree() const {
+    size_t result = 0;
+    for (uint32_t i = 0; i < vertex_count(); ++i) {
+        result = std::max(result, degree(i));
+    }
+    return result;
+}
+
+template <typename VertexId, typename WeightType>
+std::span<const uint32_t> CsrGraph<VertexId, WeightType>::neighbors(uint32_t index) const {
+    return {neighbors_.data() + offsets_[index], neighbors_.data() + offsets_[index + 1]};
+}
+
+template <typename VertexId, typename WeightType>
+std::span<const WeightType> CsrGraph<VertexId, WeightType>::weights(uint32_t index) const {
+    return {weights_.data() + offsets_[index], weights_.data() + offsets_[index + 1]};
+}
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType> CsrGraph<VertexId, WeightType>::from_edge_list(
+        std::span<const std::tuple<VertexId, VertexId, WeightType>> edges, size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+
+    // Validate in bulk instead of per edge
+    std::vector<char> has_self_loop(thread_count, 0);
+    parallel_for(edges.size(), thread_count, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t i = begin; i < end; ++i) {
+            if (std::get<0>(edges[i]) == std::get<1>(edges[i])) {
+                has_self_loop[worker] = 1;
+                return;
+            }
+        }
+    });
+    for (char flag : has_self_loop) {
+        if (flag) {
+            throw std::invalid_argument("Self-loops are not allowed");
+        }
+    }
+
+    // Dense indices are the positions of the ids in sorted order
+    std::vector<VertexId> vertex_ids(edges.size() * 2);
+    parallel_for(edges.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            vertex_ids[2 * i] = std::get<0>(edges[i]);
+            vertex_ids[2 * i + 1] = std::get<1>(edges[i]);
+        }
+    });
+    parallel_sort(vertex_ids, std::less<VertexId>(), thread_count);
+    vertex_ids.erase(std::unique(vertex_ids.begin(), vertex_ids.end()), vertex_ids.end());
+
+    if (vertex_ids.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Too many vertices for CSR indices");
+    }
+
+    struct DenseEdge {
+        uint32_t low;
+        uint32_t high;
+        size_t position;
+        WeightType weight;
+    };
+
+    auto dense_index = [&vertex_ids](const VertexId& id) {
+        return static_cast<uint32_t>(std::lower_bound(vertex_ids.begin(), vertex_ids.end(), id) - vertex_ids.begin());
+    };
+
+    std::vector<DenseEdge> dense(edges.size());
+    parallel_for(edges.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            uint32_t a = dense_index(std::get<0>(edges[i]));
+            uint32_t b = dense_index(std::get<1>(edges[i]));
+            dense[i] = {std::min(a, b), std::max(a, b), i, std::get<2>(edges[i])};
+        }
+    });
+
+    // Sorting by (low, high, position) puts the first occurrence of every duplicate in front
+    parallel_sort(dense, [](const DenseEdge& x, const DenseEdge& y) {
+        if (x.low != y.low) return x.low < y.low;
+        if (x.high != y.high) return x.high < y.high;
+        return x.position < y.position;
+    }, thread_count);
+    dense.erase(std::unique(dense.begin(), dense.end(), [](const DenseEdge& x, const DenseEdge& y) {
+        return x.low == y.low && x.high == y.high;
+    }), dense.end());
+
+    // Counting sort by source with shared atomic counters, so memory stays O(V + E) for any thread count
+    const size_t n = vertex_ids.size();
+    std::vector<std::atomic<size_t>> cursor(n);
+
+    parallel_for(dense.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            cursor[dense[i].low].fetch_add(1, std::memory_order_relaxed);
+            cursor[dense[i].high].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<size_t> offsets(n + 1, 0);
+    for (size_t v = 0; v < n; ++v) {
+        offsets[v + 1] = offsets[v] + cursor[v].load(std::memory_order_relaxed);
+        cursor[v].store(offsets[v], std::memory_order_relaxed);
+    }
+
+    std::vector<std::pair<uint32_t, WeightType>> entries(offsets.back());
+    parallel_for(dense.size(), thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            const DenseEdge& edge = dense[i];
+            entries[cursor[edge.low].fetch_add(1, std::memory_order_relaxed)] = {edge.high, edge.weight};
+            entries[cursor[edge.high].fetch_add(1, std::memory_order_relaxed)] = {edge.low, edge.weight};
+        }
+    });
+
+    // Scatter order depends on scheduling, so rows are sorted afterwards to keep the layout deterministic
+    std::vector<uint32_t> neighbors(offsets.back());
+    std::vector<WeightType> weights(offsets.back());
+    parallel_for(n, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            std::sort(entries.begin() + offsets[v], entries.begin() + offsets[v + 1],
+                [](const auto& x, const auto& y) { return x.first < y.first; });
+            for (size_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+                neighbors[e] = entries[e].first;
+                weights[e] = entries[e].second;
+            }
+        }
+    });
+
+    return CsrGraph(std::move(vertex_ids), std::move(offsets), std::move(neighbors), std::move(weights));
+}
+
+
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::save_binary(const std::string& filename) const {
+    write_binary(filename, nullptr, nullptr, 0);
+}
+
+template <typename VertexId, typename WeightType>
+template <typename Payload>
+void CsrGraph<VertexId, WeightType>::save_binary(const std::string& filename,
+                                                 std::span<const std::optional<Payload>> payloads) const {
+    static_assert(std::is_trivially_copyable_v<Payload>, "Binary payloads must be trivially copyable");
+    if (payloads.size() != vertex_count()) {
+        throw std::invalid_argument("Expected one payload entry per vertex");
+    }
+
+    std::vector<Payload> packed(payloads.size());
+    std::vector<uint8_t> flags(payloads.size(), 0);
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        if (payloads[i]) {
+            packed[i] = *payloads[i];
+            flags[i] = 1;
+        }
+    }
+
+    write_binary(filename, reinterpret_cast<const std::byte*>(packed.data()), flags.data(), sizeof(Payload));
+}
+
+template <typename VertexId, typename WeightType>
+void CsrGraph<VertexId, WeightType>::write_binary(const std::string& filename, const std::byte* payloads,
+                                                  const uint8_t* payload_flags, size_t payload_size) const {
+    static_assert(std::is_trivially_copyable_v<VertexId> && std::is_trivially_copyable_v<WeightType>,
+                  "Binary format requires trivially copyable vertex ids and weights");
+
+    auto align_up = [](uint64_t position) {
+        const uint64_t alignment = GraphFileHeader::alignment;
+        return (position + alignment - 1) / alignment * alignment;
+    };
+
+    GraphFileHeader header{};
+    std::memcpy(header.magic, GraphFileHeader::magic_value, sizeof(header.magic));
+    header.version = GraphFileHeader::current_version;
+    header.byte_order = GraphFileHeader::byte_order_mark;
+    header.flags = (sorted_ids_ ? GraphFileHeader::sorted_ids : 0) |
+                   (payloads != nullptr ? GraphFileHeader::has_payloads : 0);
+    header.offset_size = sizeof(size_t);
+    header.id_size = sizeof(VertexId);
+    header.weight_size = sizeof(WeightType);
+    header.payload_size = payload_size;
+    header.vertex_count = vertex_ids_.size();
+    header.entry_count = neighbors_.size();
+
+    header.offsets_position = align_up(sizeof(GraphFileHeader));
+    header.neighbors_position = align_up(header.offsets_position + offsets_.size_bytes());
+    header.weights_position = align_up(header.neighbors_position + neighbors_.size_bytes());
+    header.ids_position = align_up(header.weights_position + weights_.size_bytes());
+    header.payload_flags_position = align_up(header.ids_position + vertex_ids_.size_bytes());
+    header.payloads_position = align_up(header.payload_flags_position + (payloads ? vertex_ids_.size() : 0));
+    uint64_t end = header.payloads_position + (payloads ? vertex_ids_.size() * payload_size : 0);
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file for writing");
+    }
+
+    auto write_section = [](std::ofstream& file, uint64_t position, const void* data, size_t bytes) {
+        file.seekp(static_cast<std::streamoff>(position));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+    write_section(file, 0, &header, sizeof(header));
+    write_section(file, header.offsets_position, offsets_.data(), offsets_.size_bytes());
+    write_section(file, header.neighbors_position, neighbors_.data(), neighbors_.size_bytes());
+    write_section(file, header.weights_position, weights_.data(), weights_.size_bytes());
+    write_section(file, header.ids_position, vertex_ids_.data(), vertex_ids_.size_bytes());
+    if (payloads != nullptr) {
+        write_section(file, header.payload_flags_position, payload_flags, vertex_ids_.size());
+        write_section(file, header.payloads_position, payloads, vertex_ids_.size() * payload_size);
+    }
+
+    // Pad the tail so every section lies fully inside the file
+    if (static_cast<uint64_t>(file.tellp()) < end) {
+        char zero = 0;
+        write_section(file, end - 1, &zero, 1);
+    }
+
+    if (!file) {
+        throw std::runtime_error("Failed to write graph file");
+    }
+}
+
+template <typename VertexId, typename WeightType>
+CsrGraph<VertexId, WeightType> CsrGraph<VertexId, WeightType>::map_binary(const std::string& filename,
+                                                                           bool trusted) {
+    static_assert(std::is_trivially_copyable_v<VertexId> && std::is_trivially_copyable_v<WeightType>,
+                  "Binary format requires trivially copyable vertex ids and weights");
+
+    auto mapping = std::make_shared<const MappedFile>(filename);
+    const std::byte* base = mapping->data();
+    const uint64_t file_size = mapping->size();
+
+    if (file_size < sizeof(GraphFileHeader)) {
+        throw std::runtime_error("Malformed graph file: truncated header");
+    }
+    GraphFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+
+    if (std::memcmp(header.magic, GraphFileHeader::magic_value, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Malformed graph file: bad magic");
+    }
+    if (header.version != GraphFileHeader::current_version) {
+        throw std::runtime_error("Unsupported graph file version");
+    }
+    if (header.byte_order != GraphFileHeader::byte_order_mark) {
+        throw std::runtime_error("Graph file was written with a different byte order");
+    }
+    if (header.offset_size != sizeof(size_t) || header.id_size != sizeof(VertexId) ||
+        header.weight_size != sizeof(WeightType)) {
+        throw std::runtime_error("Graph file types do not match the requested graph type");
+    }
+    if (header.vertex_count > std::numeric_limits<uint32_t>::max() || header.entry_count % 2 != 0) {
+        throw std::runtime_error("Malformed graph file: bad counts");
+    }
+
+    const bool has_payloads = header.flags & GraphFileHeader::has_payloads;
+    // Sections hold count elements of element_size bytes. The count is compared against what fits in
+    // the file before anything is multiplied, so crafted counts can't wrap the length around
+    auto section = [&](uint64_t position, uint64_t count, uint64_t element_size) {
+        if (position % GraphFileHeader::alignment != 0 || position > file_size ||
+            (element_size != 0 && count > (file_size - position) / element_size)) {
+            throw std::runtime_error("Malformed graph file: section out of bounds");
+        }
+        return base + position;
+    };
+
+    CsrGraph graph;
+    graph.offsets_storage_.clear();
+    graph.offsets_ = {reinterpret_cast<const size_t*>(
+        section(header.offsets_position, header.vertex_count + 1, sizeof(size_t))), header.vertex_count + 1};
+    graph.neighbors_ = {reinterpret_cast<const uint32_t*>(
+        section(header.neighbors_position, header.entry_count, sizeof(uint32_t))), header.entry_count};
+    graph.weights_ = {reinterpret_cast<const WeightType*>(
+        section(header.weights_position, header.entry_count, sizeof(WeightType))), header.entry_count};
+    graph.vertex_ids_ = {reinterpret_cast<const VertexId*>(
+        section(header.ids_position, header.vertex_count, sizeof(VertexId))), header.vertex_count};
+
+    if (has_payloads) {
+        graph.payload_flags_ = {reinterpret_cast<const uint8_t*>(
+            section(header.payload_flags_position, header.vertex_count, 1)), header.vertex_count};
+        graph.payloads_ = section(header.payloads_position, header.vertex_count, header.payload_size);
+        graph.payload_size_ = header.payload_size;
+    }
+
+    if (graph.offsets_.front() != 0 || graph.offsets_.back() != header.entry_count) {
+        throw std::runtime_error("Malformed graph file: inconsistent offsets");
+    }
+
+    graph.mapping_ = std::move(mapping);
+    if (trusted) {
+        if constexpr (std::totally_ordered<VertexId>) {
+            if (header.flags & GraphFileHeader::sorted_ids) {
+                graph.sorted_ids_ = true;
+                return graph;
+            }
+        }
+        graph.build_index();
+        return graph;
+    }
+
+    // Every algorithm indexes offsets_[u + 1] and neighbors_[e] unchecked, so the interior has to hold up too
+    for (size_t u = 0; u < header.vertex_count; ++u) {
+        if (graph.offsets_[u] > graph.offsets_[u + 1]) {
+            throw std::runtime_error("Malformed graph file: inconsistent offsets");
+        }
+    }
+    for (uint32_t neighbor : graph.neighbors_) {
+        if (neighbor >= header.vertex_count) {
+            throw std::runtime_error("Malformed graph file: neighbor out of range");
+        }
+    }
+
+    // The sorted_ids flag is not trusted: build_index works out the order itself
+    graph.build_index();
+    if (!graph.sorted_ids_ && graph.index_.size() != graph.vertex_ids_.size()) {
+        throw std::runtime_error("Malformed graph file: duplicate vertex ids");
+    }
+    return graph;
+}
+
+template <typename VertexId, typename WeightType>
+template <typename Payload>
+const Payload* CsrGraph<VertexId, WeightType>::payload(uint32_t index) const {
+    if (payloads_ == nullptr || !payload_flags_[index]) {
+        return nullptr;
+    }
+    if (sizeof(Payload) != payload_size_) {
+        throw std::invalid_argument("Payload type does not match the stored payloads");
+    }
+    return reinterpret_cast<const Payload*>(payloads_ + static_cast<size_t>(index) * payload_size_);
+}
@@ -0,0 +1,47 @@
+#include "../include/disjoint_sets.hpp"
+#include <utility>
+
+
+inline DisjointSets::DisjointSets(size_t count) {
+    reset(count);
+}
+
+inline void DisjointSets::reset(size_t count) {
+    parents_.resize(count);
+    sizes_.assign(count, 1);
+    for (uint32_t i = 0; i < count; ++i) {
+        parents_[i] = i;
+    }
+    set_count_ = count;
+}
+
+inline uint32_t DisjointSets::add() {
+    uint32_t element = static_cast<uint32_t>(parents_.size());
+    parents_.push_back(element);
+    sizes_.push_back(1);
+    ++set_count_;
+    return element;
+}
+
+inline uint32_t DisjointSets::find(uint32_t element) {
+    while (parents_[element] != element) {
+        parents_[element] = parents_[parents_[element]];
+        element = parents_[element];
+    }
+    return element;
+}
+
+inline bool DisjointSets::unite(uint32_t a, uint32_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+        return false;
+    }
+    if (sizes_[a] < sizes_[b]) {
+        std::swap(a, b);
+    }
+    parents_[b] = a;
+    sizes_[a] += sizes_[b];
+    --set_count_;
+    return true;
+}
@@ -0,0 +1,447 @@
+#include "../include/dynamic_connectivity.hpp"
+#include <stdexcept>
+#include <utility>
+
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::id_of(const VertexId& vertex) const {
+    auto it = ids_.find(vertex);
+    if (it == ids_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return it->second;
+}
+
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::make_node(uint32_t from, uint32_t to) {
+    uint32_t node;
+    if (!free_nodes_.empty()) {
+        node = free_nodes_.back();
+        free_nodes_.pop_back();
+    } else {
+        node = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    Node& created = nodes_[node];
+    created = Node();
+    created.priority = static_cast<uint32_t>(rng_());
+    created.from = from;
+    created.to = to;
+    created.vertex_count = from == to;
+    return node;
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::free_node(uint32_t node) {
+    free_nodes_.push_back(node);
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::pull(uint32_t node) {
+    Node& current = nodes_[node];
+    current.size = 1;
+    current.vertex_count = current.from == current.to;
+    current.subtree_flags = current.flags;
+    for (uint32_t child : {current.left, current.right}) {
+        if (child != none) {
+            current.size += nodes_[child].size;
+            current.vertex_count += nodes_[child].vertex_count;
+            current.subtree_flags |= nodes_[child].subtree_flags;
+        }
+    }
+}
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::merge(uint32_t a, uint32_t b) {
+    if (a == none) {
+        return b;
+    }
+    if (b == none) {
+        return a;
+    }
+
+    if (nodes_[a].priority > nodes_[b].priority) {
+        uint32_t right = merge(nodes_[a].right, b);
+        nodes_[a].right = right;
+        nodes_[right].parent = a;
+        pull(a);
+        nodes_[a].parent = none;
+        return a;
+    }
+
+    uint32_t left = merge(a, nodes_[b].left);
+    nodes_[b].left = left;
+    nodes_[left].parent = b;
+    pull(b);
+    nodes_[b].parent = none;
+    return b;
+}
+
+// First count nodes go left
+template <typename VertexId>
+std::pair<uint32_t, uint32_t> DynamicConnectivity<VertexId>::split(uint32_t root, uint32_t count) {
+    if (root == none) {
+        return {none, none};
+    }
+
+    uint32_t left_size = nodes_[root].left == none ? 0 : nodes_[nodes_[root].left].size;
+    nodes_[root].parent = none;
+
+    if (count <= left_size) {
+        auto [first, second] = split(nodes_[root].left, count);
+        nodes_[root].left = second;
+        if (second != none) {
+            nodes_[second].parent = root;
+        }
+        pull(root);
+        return {first, root};
+    }
+
+    auto [first, second] = split(nodes_[root].right, count - left_size - 1);
+    nodes_[root].right = first;
+    if (first != none) {
+        nodes_[first].parent = root;
+    }
+    pull(root);
+    return {root, second};
+}
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::root_of(uint32_t node) const {
+    while (nodes_[node].parent != none) {
+        node = nodes_[node].parent;
+    }
+    return node;
+}
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::position_of(uint32_t node) const {
+    uint32_t position = nodes_[node].left == none ? 0 : nodes_[nodes_[node].left].size;
+    while (nodes_[node].parent != none) {
+        uint32_t parent = nodes_[node].parent;
+        if (nodes_[parent].right == node) {
+            position += 1 + (nodes_[parent].left == none ? 0 : nodes_[nodes_[parent].left].size);
+        }
+        node = parent;
+    }
+    return position;
+}
+
+// Rotates the tour so that it starts at node
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::reroot(uint32_t node) {
+    auto [first, second] = split(root_of(node), position_of(node));
+    return merge(second, first);
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::set_flag(uint32_t node, uint8_t flag, bool on) {
+    if (on) {
+        nodes_[node].flags |= flag;
+    } else {
+        nodes_[node].flags &= static_cast<uint8_t>(~flag);
+    }
+    for (; node != none; node = nodes_[node].parent) {
+        pull(node);
+    }
+}
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::find_flagged(uint32_t root, uint8_t flag) const {
+    if (!(nodes_[root].subtree_flags & flag)) {
+        return none;
+    }
+
+    uint32_t node = root;
+    while (!(nodes_[node].flags & flag)) {
+        uint32_t left = nodes_[node].left;
+        node = left != none && (nodes_[left].subtree_flags & flag) ? left : nodes_[node].right;
+    }
+    return node;
+}
+
+
+template <typename VertexId>
+uint32_t DynamicConnectivity<VertexId>::vertex_node(uint32_t level, uint32_t vertex) {
+    auto it = levels_[level].vertex_nodes.find(vertex);
+    if (it != levels_[level].vertex_nodes.end()) {
+        return it->second;
+    }
+
+    uint32_t node = make_node(vertex, vertex);
+    levels_[level].vertex_nodes.emplace(vertex, node);
+    return node;
+}
+
+template <typename VertexId>
+bool DynamicConnectivity<VertexId>::connected_at(uint32_t level, uint32_t a, uint32_t b) const {
+    if (a == b) {
+        return true;
+    }
+
+    const auto& vertex_nodes = levels_[level].vertex_nodes;
+    auto a_it = vertex_nodes.find(a);
+    auto b_it = vertex_nodes.find(b);
+    if (a_it == vertex_nodes.end() || b_it == vertex_nodes.end()) {
+        return false;
+    }
+    return root_of(a_it->second) == root_of(b_it->second);
+}
+
+// Tour of a, arc a->b, tour of b, arc b->a; edge_level marks the edge as one of this level
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::link(uint32_t level, uint32_t a, uint32_t b, bool edge_level) {
+    uint32_t a_node = vertex_node(level, a);
+    uint32_t b_node = vertex_node(level, b);
+    uint32_t forward = make_node(a, b);
+    uint32_t backward = make_node(b, a);
+
+    // Only one of the two arcs carries the flag, so each edge is found once
+    if (edge_level) {
+        set_flag(a < b ? forward : backward, tree_edge_flag, true);
+    }
+
+    levels_[level].arcs.emplace(key(a, b), forward);
+    levels_[level].arcs.emplace(key(b, a), backward);
+
+    uint32_t a_tour = reroot(a_node);
+    uint32_t b_tour = reroot(b_node);
+    merge(merge(merge(a_tour, forward), b_tour), backward);
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::cut(uint32_t level, uint32_t a, uint32_t b) {
+    auto& arcs = levels_[level].arcs;
+    uint32_t first = arcs.at(key(a, b));
+    uint32_t second = arcs.at(key(b, a));
+    arcs.erase(key(a, b));
+    arcs.erase(key(b, a));
+
+    uint32_t first_position = position_of(first);
+    uint32_t second_position = position_of(second);
+    if (first_position > second_position) {
+        std::swap(first, second);
+        std::swap(first_position, second_position);
+    }
+
+    // Tour is outer_left, first, inner, second, outer_right; inner is the tour of the side that splits off
+    auto [outer_left, rest] = split(root_of(first), first_position);
+    auto [middle, tail] = split(rest, second_position - first_position);
+    auto [first_arc, inner] = split(middle, 1);
+    auto [second_arc, outer_right] = split(tail, 1);
+    merge(outer_left, outer_right);
+
+    free_node(first_arc);
+    free_node(second_arc);
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::add_non_tree(uint32_t level, uint32_t a, uint32_t b) {
+    EdgeInfo& info = edges_.at(edge_key(a, b));
+    info.level = level;
+
+    for (auto [vertex, other] : {std::pair(a, b), std::pair(b, a)}) {
+        auto& list = levels_[level].non_tree[vertex];
+        (vertex < other ? info.low_position : info.high_position) = static_cast<uint32_t>(list.size());
+        list.push_back(other);
+        if (list.size() == 1) {
+            set_flag(vertex_node(level, vertex), non_tree_flag, true);
+        }
+    }
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::remove_non_tree(uint32_t level, uint32_t a, uint32_t b) {
+    const EdgeInfo info = edges_.at(edge_key(a, b));
+
+    for (auto [vertex, other] : {std::pair(a, b), std::pair(b, a)}) {
+        auto list_it = levels_[level].non_tree.find(vertex);
+        auto& list = list_it->second;
+        uint32_t position = vertex < other ? info.low_position : info.high_position;
+
+        // Swap-remove, then tell the moved edge where it went
+        uint32_t moved = list.back();
+        list[position] = moved;
+        list.pop_back();
+        if (moved != other) {
+            EdgeInfo& moved_info = edges_.at(edge_key(vertex, moved));
+            (vertex < moved ? moved_info.low_position : moved_info.high_position) = position;
+        }
+
+        if (list.empty()) {
+            levels_[level].non_tree.erase(list_it);
+            set_flag(levels_[level].vertex_nodes.at(vertex), non_tree_flag, false);
+        }
+    }
+}
+
+// Called after the tree edge a-b was cut from levels 0..level; true if a replacement edge was found
+template <typename VertexId>
+bool DynamicConnectivity<VertexId>::replace(uint32_t level, uint32_t a, uint32_t b) {
+    if (levels_.size() == level + 1) {
+        levels_.emplace_back();
+    }
+
+    uint32_t small_root = root_of(vertex_node(level, a));
+    uint32_t large_root = root_of(vertex_node(level, b));
+    if (nodes_[small_root].vertex_count > nodes_[large_root].vertex_count) {
+        std::swap(small_root, large_root);
+    }
+
+    // The smaller side has at most half the vertices, so its tree edges can move one level up
+    for (uint32_t arc = find_flagged(small_root, tree_edge_flag); arc != none;
+         arc = find_flagged(small_root, tree_edge_flag)) {
+        uint32_t from = nodes_[arc].from;
+        uint32_t to = nodes_[arc].to;
+        set_flag(arc, tree_edge_flag, false);
+        edges_.at(edge_key(from, to)).level = level + 1;
+        link(level + 1, from, to, true);
+    }
+
+    // Every non-tree edge of this level inside the smaller side is either the replacement or goes up a level
+    for (uint32_t node = find_flagged(small_root, non_tree_flag); node != none;
+         node = find_flagged(small_root, non_tree_flag)) {
+        uint32_t vertex = nodes_[node].from;
+
+        while (true) {
+            auto list_it = levels_[level].non_tree.find(vertex);
+            if (list_it == levels_[level].non_tree.end()) {
+                break;
+            }
+            uint32_t other = list_it->second.back();
+            remove_non_tree(level, vertex, other);
+
+            if (root_of(levels_[level].vertex_nodes.at(other)) != small_root) {
+                edges_.at(edge_key(vertex, other)).tree = true;
+                for (uint32_t i = 0; i <= level; ++i) {
+                    link(i, vertex, other, i == level);
+                }
+                ++tree_edge_count_;
+                return true;
+            }
+
+            add_non_tree(level + 1, vertex, other);
+        }
+    }
+
+    return false;
+}
+
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::add_vertex(const VertexId& vertex) {
+    if (ids_.find(vertex) != ids_.end()) {
+        throw std::invalid_argument("Vertex already exists");
+    }
+
+    uint32_t id = next_id_;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+    } else {
+        ++next_id_;
+    }
+    ids_.emplace(vertex, id);
+
+    if (levels_.empty()) {
+        levels_.emplace_back();
+    }
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::remove_vertex(const VertexId& vertex) {
+    uint32_t id = id_of(vertex);
+
+    // An isolated vertex is a single node wherever it has one
+    for (auto& level : levels_) {
+        auto it = level.vertex_nodes.find(id);
+        if (it != level.vertex_nodes.end()) {
+            if (nodes_[root_of(it->second)].size != 1 || level.non_tree.find(id) != level.non_tree.end()) {
+                throw std::invalid_argument("Vertex still has edges");
+            }
+            free_node(it->second);
+            level.vertex_nodes.erase(it);
+        }
+    }
+
+    ids_.erase(vertex);
+    free_ids_.push_back(id);
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::add_edge(const VertexId& u, const VertexId& v) {
+    uint32_t a = id_of(u);
+    uint32_t b = id_of(v);
+    if (a == b) {
+        throw std::invalid_argument("Self-loops are not allowed");
+    }
+    if (!edges_.emplace(edge_key(a, b), EdgeInfo()).second) {
+        throw std::invalid_argument("Edge already exists");
+    }
+
+    if (connected_at(0, a, b)) {
+        add_non_tree(0, a, b);
+    } else {
+        edges_.at(edge_key(a, b)).tree = true;
+        link(0, a, b, true);
+        ++tree_edge_count_;
+    }
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::remove_edge(const VertexId& u, const VertexId& v) {
+    uint32_t a = id_of(u);
+    uint32_t b = id_of(v);
+    auto it = edges_.find(edge_key(a, b));
+    if (it == edges_.end()) {
+        throw std::invalid_argument("Edge does not exist");
+    }
+    const EdgeInfo info = it->second;
+
+    if (!info.tree) {
+        remove_non_tree(info.level, a, b);
+        edges_.erase(edge_key(a, b));
+        return;
+    }
+
+    edges_.erase(it);
+    for (uint32_t i = 0; i <= info.level; ++i) {
+        cut(i, a, b);
+    }
+    --tree_edge_count_;
+
+    // Replacements are searched from the edge's own level down, where the candidate sets only grow
+    for (uint32_t i = info.level + 1; i-- > 0;) {
+        if (replace(i, a, b)) {
+            return;
+        }
+    }
+}
+
+template <typename VertexId>
+void DynamicConnectivity<VertexId>::clear() {
+    nodes_.clear();
+    free_nodes_.clear();
+    levels_.clear();
+    edges_.clear();
+    ids_.clear();
+    free_ids_.clear();
+    next_id_ = 0;
+    tree_edge_count_ = 0;
+}
+
+
+template <typename VertexId>
+bool DynamicConnectivity<VertexId>::connected(const VertexId& u, const VertexId& v) const {
+    return connected_at(0, id_of(u), id_of(v));
+}
+
+template <typename VertexId>
+size_t DynamicConnectivity<VertexId>::component_size(const VertexId& vertex) const {
+    uint32_t id = id_of(vertex);
+    const auto& vertex_nodes = levels_[0].vertex_nodes;
+    auto it = vertex_nodes.find(id);
+    return it == vertex_nodes.end() ? 1 : nodes_[root_of(it->second)].vertex_count;
+}
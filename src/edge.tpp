@@ -7,7 +7,8 @@ Edge<VertexId, W>::Edge(VertexId f, VertexId t, W w) : from_(f), to_(t), weight_
 template <typename VertexId, typename W>
 Edge<VertexId, W>::Edge(const Edge& other_edge): 
         from_(other_edge.from_), to_(other_edge.to_), 
-        weight_(other_edge.weight_), is_bridge_(other_edge.is_bridge_) {}
+        weight_(other_edge.weight_), is_bridge_(other_edge.is_bridge_),
+        from_slot_(other_edge.from_slot_), to_slot_(other_edge.to_slot_) {}
 
 
 template <typename VertexId, typename W>
@@ -17,6 +18,8 @@ Edge<VertexId, W>& Edge<VertexId, W>::operator=(const Edge& other_edge) {
         to_ = other_edge.to_;
         weight_ = other_edge.weight_;
         is_bridge_ = other_edge.is_bridge_;
+        from_slot_ = other_edge.from_slot_;
+        to_slot_ = other_edge.to_slot_;
     }
     return *this;
 }
@@ -24,7 +27,8 @@ Edge<VertexId, W>& Edge<VertexId, W>::operator=(const Edge& other_edge) {
 template <typename VertexId, typename W>
 Edge<VertexId, W>::Edge(Edge&& other_edge) noexcept: 
         from_(std::move(other_edge.from_)), to_(std::move(other_edge.to_)), 
-        weight_(std::move(other_edge.weight_)), is_bridge_(other_edge.is_bridge_) {
+        weight_(std::move(other_edge.weight_)), is_bridge_(other_edge.is_bridge_),
+        from_slot_(other_edge.from_slot_), to_slot_(other_edge.to_slot_) {
 
     other_edge.is_bridge_ = false;
 }
@@ -36,6 +40,8 @@ Edge<VertexId, W>& Edge<VertexId, W>::operator=(Edge&& other_edge) noexcept {
         to_ = std::move(other_edge.to_);
         weight_ = std::move(other_edge.weight_);
         is_bridge_ = other_edge.is_bridge_;
+        from_slot_ = other_edge.from_slot_;
+        to_slot_ = other_edge.to_slot_;
         other_edge.is_bridge_ = false;
     }
     return *this;
@@ -85,3 +91,24 @@ template <typename VertexId, typename W>
 void Edge<VertexId, W>::set_bridge(bool value) {
     is_bridge_ = value;
 }
+
+template <typename VertexId, typename W>
+uint32_t Edge<VertexId, W>::get_from_slot() const noexcept {
+    return from_slot_;
+}
+
+template <typename VertexId, typename W>
+uint32_t Edge<VertexId, W>::get_to_slot() const noexcept {
+    return to_slot_;
+}
+
+template <typename VertexId, typename W>
+uint32_t Edge<VertexId, W>::opposite_slot(uint32_t slot) const noexcept {
+    return slot == from_slot_ ? to_slot_ : from_slot_;
+}
+
+template <typename VertexId, typename W>
+void Edge<VertexId, W>::set_slots(uint32_t from_slot, uint32_t to_slot) noexcept {
+    from_slot_ = from_slot;
+    to_slot_ = to_slot;
+}
@@ -0,0 +1,120 @@
+#include "../include/edge_arena.hpp"
+#include <algorithm>
+#include <utility>
+
+
+template <typename VertexId, typename W>
+EdgeArena<VertexId, W>::EdgeArena(EdgeArena&& other) noexcept :
+    chunks_(std::move(other.chunks_)),
+    chunk_capacity_(other.chunk_capacity_),
+    chunk_used_(other.chunk_used_),
+    free_list_(std::move(other.free_list_)),
+    live_count_(other.live_count_),
+    negative_count_(other.negative_count_),
+    max_weight_(other.max_weight_) {
+
+    other.clear();
+}
+
+template <typename VertexId, typename W>
+EdgeArena<VertexId, W>& EdgeArena<VertexId, W>::operator=(EdgeArena&& other) noexcept {
+    if (this != &other) {
+        chunks_ = std::move(other.chunks_);
+        chunk_capacity_ = other.chunk_capacity_;
+        chunk_used_ = other.chunk_used_;
+        free_list_ = std::move(other.free_list_);
+        live_count_ = other.live_count_;
+        negative_count_ = other.negative_count_;
+        max_weight_ = other.max_weight_;
+
+        other.clear();
+    }
+    return *this;
+}
+
+template <typename VertexId, typename W>
+void EdgeArena<VertexId, W>::add_chunk(size_t capacity) {
+    chunks_.emplace_back(new Edge<VertexId, W>[capacity]);
+    chunk_capacity_ = capacity;
+    chunk_used_ = 0;
+}
+
+template <typename VertexId, typename W>
+Edge<VertexId, W>* EdgeArena<VertexId, W>::create(VertexId from, VertexId to, W weight) {
+    Edge<VertexId, W>* edge;
+
+    // Reuse slots of removed edges first
+    if (!free_list_.empty()) {
+        edge = free_list_.back();
+        free_list_.pop_back();
+    } else {
+        if (chunk_used_ == chunk_capacity_) {
+            // Chunks grow geometrically, so n edges cost O(log n) allocations
+            size_t capacity = chunks_.empty() ? min_chunk_size_ : std::min(chunk_capacity_ * 2, max_chunk_size_);
+            add_chunk(capacity);
+        }
+        edge = &chunks_.back()[chunk_used_++];
+    }
+
+    *edge = Edge<VertexId, W>(from, to, weight);
+    ++live_count_;
+    negative_count_ += weight < W(0);
+    max_weight_ = std::max(max_weight_, weight);
+    return edge;
+}
+
+template <typename VertexId, typename W>
+void EdgeArena<VertexId, W>::release(const Edge<VertexId, W>* edge) {
+    negative_count_ -= edge->get_weight() < W(0);
+    free_list_.push_back(edit(edge));
+    --live_count_;
+}
+
+template <typename VertexId, typename W>
+void EdgeArena<VertexId, W>::reweight(const Edge<VertexId, W>* edge, W weight) {
+    negative_count_ -= edge->get_weight() < W(0);
+    negative_count_ += weight < W(0);
+    max_weight_ = std::max(max_weight_, weight);
+    edit(edge)->set_weight(weight);
+}
+
+template <typename VertexId, typename W>
+Edge<VertexId, W>* EdgeArena<VertexId, W>::edit(const Edge<VertexId, W>* edge) noexcept {
+    // Every edge is a non-const object in one of our chunks, so casting the handle back is well defined
+    return const_cast<Edge<VertexId, W>*>(edge);
+}
+
+template <typename VertexId, typename W>
+void EdgeArena<VertexId, W>::reserve(size_t edge_count) {
+    size_t available = free_list_.size() + (chunk_capacity_ - chunk_used_);
+    if (edge_count <= available) {
+        return;
+    }
+
+    // The tail of the current chunk goes to the free list so that the new chunk can be used right away
+    for (; chunk_used_ < chunk_capacity_; ++chunk_used_) {
+        free_list_.push_back(&chunks_.back()[chunk_used_]);
+    }
+    add_chunk(std::max(edge_count - free_list_.size(), min_chunk_size_));
+}
+
+template <typename VertexId, typename W>
+void EdgeArena<VertexId, W>::clear() {
+    chunks_.clear();
+    free_list_.clear();
+    chunk_capacity_ = 0;
+    chunk_used_ = 0;
+    live_count_ = 0;
+    negative_count_ = 0;
+    max_weight_ = W(0);
+}
+
+template <typename VertexId, typename W>
+size_t EdgeArena<VertexId, W>::size() const noexcept {
+    return live_count_;
+}
+
+template <typename VertexId, typename W>
+size_t EdgeArena<VertexId, W>::chunk_count() const noexcept {
+    return chunks_.size();
+}
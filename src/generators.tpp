@@ -7,12 +7,11 @@ template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::generate_complete_graph(size_t n) {
 
     initialize_graph(n);
+    reserve_edges(n > 0 ? n * (n - 1) / 2 : 0);
     
     for (size_t i = 0; i < n; ++i) {
         for (size_t j = i + 1; j < n; ++j) {
-            auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(new Edge<VertexId, WeightType>(i, j, 1));
-            adjacency_list_[i][j] = edge_ptr;
-            adjacency_list_[j][i] = SharedPtr(edge_ptr);
+            link_vertices(i, j, 1);
         }
     }
 }
@@ -22,13 +21,10 @@ void Graph<VertexId, Resource, WeightType>::generate_cycle_graph(size_t n) {
     if (n < 3) throw std::invalid_argument("Cycle graph requires at least 3 vertices");
     
     initialize_graph(n);
+    reserve_edges(n);
     
     for (size_t i = 0; i < n; ++i) {
-        auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-            new Edge<VertexId, WeightType>(i, (i + 1) % n, 1)
-        );
-        adjacency_list_[i][(i + 1) % n] = edge_ptr;
-        adjacency_list_[(i + 1) % n][i] = SharedPtr(edge_ptr);
+        link_vertices(i, (i + 1) % n, 1);
     }
 }
 
@@ -37,13 +33,10 @@ void Graph<VertexId, Resource, WeightType>::generate_path_graph(size_t n) {
     if (n < 2) throw std::invalid_argument("Path graph requires at least 2 vertices");
     
     initialize_graph(n);
+    reserve_edges(n - 1);
     
     for (size_t i = 0; i < n - 1; ++i) {
-        auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-            new Edge<VertexId, WeightType>(i, i + 1, 1)
-        );
-        adjacency_list_[i][i + 1] = edge_ptr;
-        adjacency_list_[i + 1][i] = SharedPtr(edge_ptr);
+        link_vertices(i, i + 1, 1);
     }
 }
 
@@ -52,13 +45,10 @@ void Graph<VertexId, Resource, WeightType>::generate_star_graph(size_t n) {
     if (n < 2) throw std::invalid_argument("Star graph requires at least 2 vertices");
     
     initialize_graph(n);
+    reserve_edges(n - 1);
     
     for (size_t i = 1; i < n; ++i) {
-        auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-            new Edge<VertexId, WeightType>(0, i, 1)
-        );
-        adjacency_list_[0][i] = edge_ptr;
-        adjacency_list_[i][0] = SharedPtr(edge_ptr);
+        link_vertices(0, i, 1);
     }
 }
 
@@ -68,25 +58,18 @@ void Graph<VertexId, Resource, WeightType>::generate_grid_graph(size_t m, size_t
     
     size_t total_vertices = m * n;
     initialize_graph(total_vertices);
+    reserve_edges(m * (n - 1) + (m - 1) * n);
     
     for (size_t i = 0; i < m; ++i) {
         for (size_t j = 0; j < n; ++j) {
             size_t current = i * n + j;
             
             if (j + 1 < n) {
-                auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-                    new Edge<VertexId, WeightType>(current, current + 1, 1)
-                );
-                adjacency_list_[current][current + 1] = edge_ptr;
-                adjacency_list_[current + 1][current] = SharedPtr(edge_ptr);
+                link_vertices(current, current + 1, 1);
             }
             
             if (i + 1 < m) {
-                auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-                    new Edge<VertexId, WeightType>(current, current + n, 1)
-                );
-                adjacency_list_[current][current + n] = edge_ptr;
-                adjacency_list_[current + n][current] = SharedPtr(edge_ptr);
+                link_vertices(current, current + n, 1);
             }
         }
     }
@@ -96,16 +79,13 @@ template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::generate_hypercube_graph(size_t dimension) {
     size_t n = 1 << dimension;  // 2^dimension
     initialize_graph(n);
+    reserve_edges(dimension * n / 2);
     
     for (size_t i = 0; i < n; ++i) {
         for (size_t j = 0; j < dimension; ++j) {
             size_t neighbor = i ^ (1 << j);
             if (i < neighbor) {
-                auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-                    new Edge<VertexId, WeightType>(i, neighbor, 1)
-                );
-                adjacency_list_[i][neighbor] = edge_ptr;
-                adjacency_list_[neighbor][i] = SharedPtr(edge_ptr);
+                link_vertices(i, neighbor, 1);
             }
         }
     }
@@ -116,6 +96,8 @@ void Graph<VertexId, Resource, WeightType>::generate_tree(size_t n) {
     initialize_graph(n);
     
     if (n <= 1) return;
+
+    reserve_edges(n - 1);
     
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -124,11 +106,7 @@ void Graph<VertexId, Resource, WeightType>::generate_tree(size_t n) {
         std::uniform_int_distribution<size_t> dist(0, i - 1);
         size_t parent = dist(gen);
         
-        auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-            new Edge<VertexId, WeightType>(parent, i, 1)
-        );
-        adjacency_list_[parent][i] = edge_ptr;
-        adjacency_list_[i][parent] = SharedPtr(edge_ptr);
+        link_vertices(parent, i, 1);
     }
 }
 
@@ -139,6 +117,7 @@ void Graph<VertexId, Resource, WeightType>::generate_bipartite_graph(size_t m, s
     }
     
     initialize_graph(m + n);
+    reserve_edges(static_cast<size_t>(m * n * edge_probability));
     
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -147,11 +126,7 @@ void Graph<VertexId, Resource, WeightType>::generate_bipartite_graph(size_t m, s
     for (size_t i = 0; i < m; ++i) {
         for (size_t j = 0; j < n; ++j) {
             if (dist(gen) < edge_probability) {
-                auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-                    new Edge<VertexId, WeightType>(i, m + j, 1)
-                );
-                adjacency_list_[i][m + j] = edge_ptr;
-                adjacency_list_[m + j][i] = SharedPtr(edge_ptr);
+                link_vertices(i, m + j, 1);
             }
         }
     }
@@ -160,14 +135,11 @@ void Graph<VertexId, Resource, WeightType>::generate_bipartite_graph(size_t m, s
 template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::generate_complete_bipartite_graph(size_t m, size_t n) {
     initialize_graph(m + n);
+    reserve_edges(m * n);
     
     for (size_t i = 0; i < m; ++i) {
         for (size_t j = 0; j < n; ++j) {
-            auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(
-                new Edge<VertexId, WeightType>(i, m + j, 1)
-            );
-            adjacency_list_[i][m + j] = edge_ptr;
-            adjacency_list_[m + j][i] = SharedPtr(edge_ptr);
+            link_vertices(i, m + j, 1);
         }
     }
 }
@@ -1,26 +1,44 @@
 #include "../include/graph.hpp"
+#include <algorithm>
 #include <stdexcept>
 #include <fstream>
 #include <filesystem>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
 
 template <typename VertexId, typename Resource, typename WeightType>
 Graph<VertexId, Resource, WeightType>::Graph(const Graph& other) : 
-            adjacency_list_(other.adjacency_list_),
             vertex_pool_(other.vertex_pool_),
             vertex_count_(other.vertex_count_),
-            log_json_(other.log_json_) {}
+            slots_(other.slots_),
+            slot_ids_(other.slot_ids_),
+            log_json_(other.log_json_),
+            component_sets_(other.component_sets_),
+            track_components_(other.track_components_),
+            component_sets_stale_(other.component_sets_stale_),
+            connectivity_(other.connectivity_ ? std::make_unique<DynamicConnectivity<VertexId>>(*other.connectivity_)
+                                              : nullptr) {
+    copy_edges(other);
+}
 
 
 template <typename VertexId, typename Resource, typename WeightType>
 Graph<VertexId, Resource, WeightType>& Graph<VertexId, Resource, WeightType>::operator=(const Graph& other) {
     if (this != &other) {
-        adjacency_list_ = other.adjacency_list_;
         vertex_pool_= other.vertex_pool_;
         vertex_count_ = other.vertex_count_;
+        slots_ = other.slots_;
+        slot_ids_ = other.slot_ids_;
         log_json_ = other.log_json_;
+        component_sets_ = other.component_sets_;
+        track_components_ = other.track_components_;
+        component_sets_stale_ = other.component_sets_stale_;
+        connectivity_ = other.connectivity_ ? std::make_unique<DynamicConnectivity<VertexId>>(*other.connectivity_)
+                                            : nullptr;
+        copy_edges(other);
     }
     return *this;
 }
@@ -39,24 +57,61 @@ void Graph<VertexId, Resource, WeightType>::initialize_graph(size_t n) {
     adjacency_list_.clear(); 
     
     vertex_pool_.clear();
+
+    slots_.reserve(n);
+    slot_ids_.reserve(n);
     
     // Add vertices
     for(size_t i = 0; i < n; ++i) {
         vertex_pool_[i] = Vertex<VertexId, Resource>(i);
-        adjacency_list_[i] = HashTable<VertexId, SharedPtr<Edge<VertexId, WeightType>>>();
+        adjacency_list_[i] = HashTable<VertexId, EdgeHandle>();
+        slots_[i] = static_cast<uint32_t>(i);
+        slot_ids_.push_back(i);
+    }
+    rebuild_connectivity();
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::copy_edges(const Graph& other) {
+    // Edges are deep-copied into our own arena so that a copy never shares mutable edge state with the original
+    adjacency_list_.clear();
+    edge_arena_.clear();
+    edge_arena_.reserve(other.edge_arena_.size());
+
+    for (const auto& [from, edges] : other.adjacency_list_) {
+        auto& row = adjacency_list_[from];
+        for (const auto& [to, edge_ptr] : edges) {
+            if (edge_ptr->get_from() == from) {
+                Edge<VertexId, WeightType>* copy = edge_arena_.create(from, to, edge_ptr->get_weight());
+                *copy = *edge_ptr;
+                row[to] = copy;
+                adjacency_list_[to][from] = copy;
+            }
+        }
     }
 }
 
 
 template <typename VertexId, typename Resource, typename WeightType>
 Graph<VertexId, Resource, WeightType>::Graph(Graph&& other) noexcept : 
-    adjacency_list_(std::move(other.adjacency_list_)), 
     vertex_pool_(std::move(other.vertex_pool_)), 
+    edge_arena_(std::move(other.edge_arena_)),
+    adjacency_list_(std::move(other.adjacency_list_)), 
     vertex_count_(other.vertex_count_),
-    log_json_(std::move(other.log_json_)) {
+    slots_(std::move(other.slots_)),
+    slot_ids_(std::move(other.slot_ids_)),
+    log_json_(std::move(other.log_json_)),
+    component_sets_(std::move(other.component_sets_)),
+    track_components_(other.track_components_),
+    component_sets_stale_(other.component_sets_stale_),
+    connectivity_(std::move(other.connectivity_)) {
         
+        other.component_sets_stale_ = true;
         other.adjacency_list_.clear();
         other.vertex_pool_.clear();
+        other.slots_.clear();
+        other.slot_ids_.clear();
         other.log_json_.clear();
         other.vertex_count_ = 0;
     }
@@ -66,13 +121,22 @@ template <typename VertexId, typename Resource, typename WeightType>
 Graph<VertexId, Resource, WeightType>& Graph<VertexId, Resource, WeightType>::operator=(Graph&& other) noexcept {
     if (this != &other) {
         adjacency_list_ = std::move(other.adjacency_list_);
+        edge_arena_ = std::move(other.edge_arena_);
         vertex_pool_ = std::move(other.vertex_pool_);
         vertex_count_ = other.vertex_count_;
+        slots_ = std::move(other.slots_);
+        slot_ids_ = std::move(other.slot_ids_);
         log_json_ = std::move(other.log_json_);
+        component_sets_ = std::move(other.component_sets_);
+        track_components_ = other.track_components_;
+        component_sets_stale_ = other.component_sets_stale_;
+        connectivity_ = std::move(other.connectivity_);
         
-        
+        other.component_sets_stale_ = true;
         other.adjacency_list_.clear();
         other.vertex_pool_.clear();
+        other.slots_.clear();
+        other.slot_ids_.clear();
         other.log_json_.clear();
         other.vertex_count_ = 0;
     }
@@ -93,10 +157,96 @@ void Graph<VertexId, Resource, WeightType>::add_edge(VertexId from, VertexId to,
         throw std::invalid_argument("Self-loops are not allowed");
     }
 
-    auto edge_ptr = SharedPtr<Edge<VertexId, WeightType>>(new Edge<VertexId, WeightType>(from, to, weight));
+    link_vertices(from, to, weight);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::link_vertices(VertexId from, VertexId to, WeightType weight) {
+    Edge<VertexId, WeightType>* edge_ptr = edge_arena_.create(from, to, weight);
+    edge_ptr->set_slots(slots_.at(from), slots_.at(to));
 
     adjacency_list_[from][to] = edge_ptr;
-    adjacency_list_[to][from] = SharedPtr(edge_ptr);
+    adjacency_list_[to][from] = edge_ptr;
+
+    if (track_components_ && !component_sets_stale_) {
+        component_sets_.unite(edge_ptr->get_from_slot(), edge_ptr->get_to_slot());
+    } else {
+        component_sets_stale_ = true;
+    }
+    if (connectivity_) {
+        connectivity_->add_edge(from, to);
+    }
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::reserve_vertices(size_t vertex_count) {
+    vertex_pool_.reserve(vertex_count);
+    adjacency_list_.reserve(vertex_count);
+    slots_.reserve(vertex_count);
+    slot_ids_.reserve(vertex_count);
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::reserve_edges(size_t edge_count) {
+    edge_arena_.reserve(edge_count);
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+Graph<VertexId, Resource, WeightType> Graph<VertexId, Resource, WeightType>::from_edge_list(
+        std::span<const std::tuple<VertexId, VertexId, WeightType>> edges, size_t thread_count) {
+    Graph graph;
+    graph.assign_csr(CsrGraph<VertexId, WeightType>::from_edge_list(edges, thread_count));
+    return graph;
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::assign_csr(const CsrGraph<VertexId, WeightType>& csr) {
+    auto ids = csr.get_vertex_ids();
+
+    clear();
+    vertex_pool_.reserve(ids.size());
+    adjacency_list_.reserve(ids.size());
+    slots_.reserve(ids.size());
+    slot_ids_.assign(ids.begin(), ids.end());
+    vertex_count_ = ids.size();
+    reserve_edges(csr.edge_count());
+
+    // The snapshot is already validated, so edges go straight into pre-sized rows
+    std::vector<HashTable<VertexId, EdgeHandle>*> rows(ids.size());
+    for (uint32_t i = 0; i < ids.size(); ++i) {
+        const Resource* data = nullptr;
+        if constexpr (std::is_trivially_copyable_v<Resource>) {
+            data = csr.template payload<Resource>(i);
+        }
+        if (data != nullptr) {
+            vertex_pool_.emplace(ids[i], Vertex<VertexId, Resource>(ids[i], *data));
+        } else {
+            vertex_pool_.emplace(ids[i], Vertex<VertexId, Resource>(ids[i]));
+        }
+        slots_.emplace(ids[i], i);
+        rows[i] = &adjacency_list_[ids[i]];
+        rows[i]->reserve(csr.degree(i));
+    }
+
+    for (uint32_t i = 0; i < ids.size(); ++i) {
+        auto neighbors = csr.neighbors(i);
+        auto weights = csr.weights(i);
+        for (size_t k = 0; k < neighbors.size(); ++k) {
+            uint32_t j = neighbors[k];
+            if (j < i) {
+                continue;
+            }
+            Edge<VertexId, WeightType>* edge_ptr = edge_arena_.create(ids[i], ids[j], weights[k]);
+            edge_ptr->set_slots(i, j);
+            (*rows[i])[ids[j]] = edge_ptr;
+            (*rows[j])[ids[i]] = edge_ptr;
+        }
+    }
+    rebuild_connectivity();
 }
 
 
@@ -107,6 +257,17 @@ void Graph<VertexId, Resource, WeightType>::add_vertex(VertexId id) {
     }
 
     vertex_pool_[id] = Vertex<VertexId, Resource>(id);
+    slots_[id] = static_cast<uint32_t>(slot_ids_.size());
+    slot_ids_.push_back(id);
+
+    if (track_components_ && !component_sets_stale_) {
+        component_sets_.add();
+    } else {
+        component_sets_stale_ = true;
+    }
+    if (connectivity_) {
+        connectivity_->add_vertex(id);
+    }
 
     ++vertex_count_;
 }
@@ -120,7 +281,18 @@ void Graph<VertexId, Resource, WeightType>::add_vertex(VertexId id, const Resour
     }
 
     vertex_pool_[id] = Vertex<VertexId, Resource>(id, data);
-    adjacency_list_[id] = HashTable<VertexId, SharedPtr<Edge<VertexId, WeightType>>>();
+    adjacency_list_[id] = HashTable<VertexId, EdgeHandle>();
+    slots_[id] = static_cast<uint32_t>(slot_ids_.size());
+    slot_ids_.push_back(id);
+
+    if (track_components_ && !component_sets_stale_) {
+        component_sets_.add();
+    } else {
+        component_sets_stale_ = true;
+    }
+    if (connectivity_) {
+        connectivity_->add_vertex(id);
+    }
 
     ++vertex_count_;
 }
@@ -133,9 +305,16 @@ void Graph<VertexId, Resource, WeightType>::remove_edge(VertexId from, VertexId
         throw std::invalid_argument("Edge does not exist");
     }
 
+    EdgeHandle edge_ptr = adjacency_list_[from][to];
+
     // remove from adjacency lists
     adjacency_list_[from].erase(to);
     adjacency_list_[to].erase(from);
+    edge_arena_.release(edge_ptr);
+    component_sets_stale_ = true;
+    if (connectivity_) {
+        connectivity_->remove_edge(from, to);
+    }
 }
 
 
@@ -145,12 +324,43 @@ void Graph<VertexId, Resource, WeightType>::remove_vertex(VertexId vertex) {
         throw std::invalid_argument("Vertex does not exist");
     }
     
-    for (const auto& [v, _] : adjacency_list_[vertex]) {
+    for (const auto& [v, edge_ptr] : adjacency_list_[vertex]) {
         adjacency_list_[v].erase(vertex);
+        edge_arena_.release(edge_ptr);
+        if (connectivity_) {
+            connectivity_->remove_edge(vertex, v);
+        }
+    }
+    if (connectivity_) {
+        connectivity_->remove_vertex(vertex);
     }
 
     adjacency_list_.erase(vertex);
     vertex_pool_.erase(vertex);
+
+    // Move the last vertex into the freed slot and patch the slots cached on its edges
+    uint32_t slot = slots_.at(vertex);
+    uint32_t last = static_cast<uint32_t>(slot_ids_.size() - 1);
+    if (slot != last) {
+        const VertexId moved = slot_ids_[last];
+        slot_ids_[slot] = moved;
+        slots_[moved] = slot;
+
+        auto adj_it = adjacency_list_.find(moved);
+        if (adj_it != adjacency_list_.end()) {
+            for (const auto& [_, edge_ptr] : adj_it->second) {
+                if (edge_ptr->get_from() == moved) {
+                    edge_arena_.edit(edge_ptr)->set_slots(slot, edge_ptr->get_to_slot());
+                } else {
+                    edge_arena_.edit(edge_ptr)->set_slots(edge_ptr->get_from_slot(), slot);
+                }
+            }
+        }
+    }
+    slot_ids_.pop_back();
+    slots_.erase(vertex);
+    component_sets_stale_ = true;
+
     --vertex_count_;
 }
 
@@ -164,6 +374,35 @@ void Graph<VertexId, Resource, WeightType>::reset_parameters() {
     }
 }
 
+template <typename VertexId, typename Resource, typename WeightType>
+TraversalResult<VertexId> Graph<VertexId, Resource, WeightType>::collect_traversal(VertexId start,
+                                                                                   const Workspace& workspace) const {
+    TraversalResult<VertexId> result;
+    result.start = start;
+    result.discovery_time.reserve(workspace.order_.size());
+    result.finish_time.reserve(workspace.order_.size());
+
+    for (uint32_t slot : workspace.order_) {
+        const VertexId& id = slot_ids_[slot];
+        result.order.push_back(id);
+        result.discovery_time[id] = workspace.discovery_times_[slot];
+        result.finish_time[id] = workspace.finish_times_[slot];
+    }
+
+    return result;
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::store_traversal(const TraversalResult<VertexId>& result) {
+    // Only reached vertices are written back, everything else keeps the values from reset_parameters()
+    for (const auto& id : result.order) {
+        auto& vertex = vertex_pool_.at(id);
+        vertex.set_color(2); // Black
+        vertex.set_discovery_time(result.discovery_time.at(id));
+        vertex.set_finish_time(result.finish_time.at(id));
+    }
+}
+
 template <typename VertexId, typename Resource, typename WeightType>
 json Graph<VertexId, Resource, WeightType>::to_json() {
     json j;
@@ -171,23 +410,25 @@ json Graph<VertexId, Resource, WeightType>::to_json() {
     j["edges"] = json::array();
     
     j["vertex_count"] = vertex_count_;
-    
-    HashTable<VertexId, size_t> vertex_mapping;
-    size_t new_index = 0;
 
-    for (const auto& [id, vertex] : vertex_pool_) {
+    // Vertices are renumbered by their slots
+    for (uint32_t slot = 0; slot < slot_ids_.size(); ++slot) {
         j["vertices"].push_back({
-            {"id", new_index}
+            {"id", slot}
         });
-        vertex_mapping[id] = new_index++;
     }
-    
-    for (const auto& [from, edges] : adjacency_list_) {
-        for (const auto& [to, edge_ptr] : edges) {
-            if (from < to) {
+
+    for (uint32_t slot = 0; slot < slot_ids_.size(); ++slot) {
+        auto row = adjacency_list_.find(slot_ids_[slot]);
+        if (row == adjacency_list_.end()) {
+            continue;
+        }
+        for (const auto& [_, edge_ptr] : row->second) {
+            uint32_t neighbor = edge_ptr->opposite_slot(slot);
+            if (slot < neighbor) {
                 j["edges"].push_back({
-                    {"from", vertex_mapping[from]},
-                    {"to", vertex_mapping[to]},
+                    {"from", slot},
+                    {"to", neighbor},
                     {"weight", edge_ptr->get_weight()}
                 });
             }
@@ -197,14 +438,50 @@ json Graph<VertexId, Resource, WeightType>::to_json() {
     return j;
 }
 
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::write_json(std::ostream& out) const {
+    // Same document as to_json(), written entry by entry instead of through a DOM. vertex_count goes first
+    // (a DOM would sort it after "edges") so that the streaming loader can reserve before any edge arrives
+    out << "{\n    \"vertex_count\": " << vertex_count_ << ",\n    \"edges\": [";
+    bool empty = true;
+    for (uint32_t slot = 0; slot < slot_ids_.size(); ++slot) {
+        auto row = adjacency_list_.find(slot_ids_[slot]);
+        if (row == adjacency_list_.end()) {
+            continue;
+        }
+        for (const auto& [_, edge_ptr] : row->second) {
+            uint32_t neighbor = edge_ptr->opposite_slot(slot);
+            if (slot >= neighbor) {
+                continue;
+            }
+            out << (empty ? "\n" : ",\n")
+                << "        {\n"
+                << "            \"from\": " << slot << ",\n"
+                << "            \"to\": " << neighbor << ",\n"
+                << "            \"weight\": " << json(edge_ptr->get_weight()).dump() << "\n"
+                << "        }";
+            empty = false;
+        }
+    }
+    out << (empty ? "]" : "\n    ]");
+
+    out << ",\n    \"vertices\": [";
+    for (uint32_t slot = 0; slot < slot_ids_.size(); ++slot) {
+        out << (slot == 0 ? "\n" : ",\n")
+            << "        {\n"
+            << "            \"id\": " << slot << "\n"
+            << "        }";
+    }
+    out << (slot_ids_.empty() ? "]" : "\n    ]") << "\n}";
+}
+
 template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::save_to_json(const std::string& filename) {
     std::ofstream file(filename);
     if (!file.is_open()) {
         throw std::runtime_error("Unable to open file for writing");
     }
-    json j = to_json();
-    file << j.dump(4);
+    write_json(file);
 }
 
 template <typename VertexId, typename Resource, typename WeightType>
@@ -213,21 +490,39 @@ void Graph<VertexId, Resource, WeightType>::load_from_json(const std::string& fi
     if (!file.is_open()) {
         throw std::runtime_error("Unable to open file for reading");
     }
-    
-    json j;
-    file >> j;
-    
+
     clear();
-    
-    for (const auto& vertex : j["vertices"]) {
-        add_vertex(vertex["id"]);
-    }
-    
-    for (const auto& edge : j["edges"]) {
-        add_edge(edge["from"], edge["to"], edge["weight"]);
+
+    // Vertices and edges are inserted as they are parsed; the document itself is never held.
+    // Without a known size (a pipe, say) vertex_count is not used for reserving at all
+    std::error_code error;
+    uintmax_t input_size = fs::file_size(filename, error);
+    GraphJsonSax<Graph, VertexId, WeightType> handler(*this, error ? 0 : static_cast<size_t>(input_size));
+    json::sax_parse(file, &handler);
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::save_to_binary(const std::string& filename) const {
+    auto csr = freeze();
+    if constexpr (std::is_trivially_copyable_v<Resource>) {
+        std::vector<std::optional<Resource>> payloads(slot_ids_.size());
+        for (uint32_t i = 0; i < slot_ids_.size(); ++i) {
+            const auto& data = vertex_pool_.at(slot_ids_[i]).get_data();
+            if (data != nullptr) {
+                payloads[i] = *data;
+            }
+        }
+        csr.save_binary(filename, std::span<const std::optional<Resource>>(payloads));
+    } else {
+        csr.save_binary(filename);
     }
 }
 
+template <typename VertexId, typename Resource, typename WeightType>
+void Graph<VertexId, Resource, WeightType>::load_from_binary(const std::string& filename) {
+    assign_csr(CsrGraph<VertexId, WeightType>::map_binary(filename));
+}
+
 template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::save_json_to_file(const std::string& filename, const json& data) {
     std::string directory = "files";
@@ -250,12 +545,70 @@ const json Graph<VertexId, Resource, WeightType>::get_json() const {
 }
 
 template <typename VertexId, typename Resource, typename WeightType>
-const HashTable<VertexId, HashTable<VertexId, SharedPtr<Edge<VertexId, WeightType>>>>& 
+const typename Graph<VertexId, Resource, WeightType>::AdjacencyList& 
 Graph<VertexId, Resource, WeightType>::get_adjacency_list() const {
     return adjacency_list_;
 }
 
 
+template <typename VertexId, typename Resource, typename WeightType>
+CsrGraph<VertexId, WeightType> Graph<VertexId, Resource, WeightType>::freeze() const {
+    // Slots are already dense, so they become the CSR indices as is
+    std::vector<VertexId> vertex_ids(slot_ids_);
+
+    std::vector<size_t> offsets(vertex_ids.size() + 1, 0);
+    for (size_t i = 0; i < vertex_ids.size(); ++i) {
+        auto it = adjacency_list_.find(vertex_ids[i]);
+        offsets[i + 1] = offsets[i] + (it == adjacency_list_.end() ? 0 : it->second.size());
+    }
+
+    std::vector<uint32_t> neighbors(offsets.back());
+    std::vector<WeightType> weights(offsets.back());
+    std::vector<std::pair<uint32_t, WeightType>> row;
+
+    for (uint32_t i = 0; i < vertex_ids.size(); ++i) {
+        auto it = adjacency_list_.find(vertex_ids[i]);
+        if (it == adjacency_list_.end()) {
+            continue;
+        }
+
+        // Sorted rows keep neighbor scans sequential in memory
+        row.clear();
+        for (const auto& [_, edge_ptr] : it->second) {
+            row.emplace_back(edge_ptr->opposite_slot(i), edge_ptr->get_weight());
+        }
+        std::sort(row.begin(), row.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        for (size_t k = 0; k < row.size(); ++k) {
+            neighbors[offsets[i] + k] = row[k].first;
+            weights[offsets[i] + k] = row[k].second;
+        }
+    }
+
+    return CsrGraph<VertexId, WeightType>(std::move(vertex_ids), std::move(offsets),
+                                          std::move(neighbors), std::move(weights));
+}
+
+
+template <typename VertexId, typename Resource, typename WeightType>
+uint32_t Graph<VertexId, Resource, WeightType>::get_slot(const VertexId& id) const {
+    auto it = slots_.find(id);
+    if (it == slots_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename VertexId, typename Resource, typename WeightType>
+const VertexId& Graph<VertexId, Resource, WeightType>::get_slot_id(uint32_t slot) const {
+    if (slot >= slot_ids_.size()) {
+        throw std::out_of_range("Slot out of range");
+    }
+    return slot_ids_[slot];
+}
+
+
 template <typename VertexId, typename Resource, typename WeightType>
 size_t Graph<VertexId, Resource, WeightType>::get_degree(const VertexId& vertex) const {
     if (!has_vertex(vertex)) {
@@ -275,8 +628,8 @@ void Graph<VertexId, Resource, WeightType>::set_edge_weight(const VertexId& from
     if (!has_edge(from, to)) {
         throw std::invalid_argument("Edge does not exist");
     }
-    adjacency_list_[from][to]->set_weight(weight);
-    adjacency_list_[to][from]->set_weight(weight);
+    // Both directions share one edge
+    edge_arena_.reweight(adjacency_list_[from][to], weight);
 }
 
 template <typename VertexId, typename Resource, typename WeightType>
@@ -335,7 +688,14 @@ bool Graph<VertexId, Resource, WeightType>::is_empty() const noexcept {
 template <typename VertexId, typename Resource, typename WeightType>
 void Graph<VertexId, Resource, WeightType>::clear() {
     adjacency_list_.clear();
+    edge_arena_.clear();
     vertex_pool_.clear();
+    slots_.clear();
+    slot_ids_.clear();
+    component_sets_stale_ = true;
+    if (connectivity_) {
+        connectivity_->clear();
+    }
     vertex_count_ = 0;
 }
 
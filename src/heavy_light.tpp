@@ -0,0 +1,259 @@
+#include "../include/heavy_light.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+
+template <typename VertexId, typename WeightType>
+HeavyLightDecomposition<VertexId, WeightType> HeavyLightDecomposition<VertexId, WeightType>::build(
+        const CsrGraph<VertexId, WeightType>& forest) {
+    return build_from(forest, 0);
+}
+
+template <typename VertexId, typename WeightType>
+HeavyLightDecomposition<VertexId, WeightType> HeavyLightDecomposition<VertexId, WeightType>::build(
+        const CsrGraph<VertexId, WeightType>& forest, const VertexId& root) {
+    if (!forest.has_vertex(root)) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return build_from(forest, forest.index_of(root));
+}
+
+template <typename VertexId, typename WeightType>
+HeavyLightDecomposition<VertexId, WeightType> HeavyLightDecomposition<VertexId, WeightType>::build_from(
+        const CsrGraph<VertexId, WeightType>& forest, uint32_t first_root) {
+    const size_t n = forest.vertex_count();
+
+    HeavyLightDecomposition hld;
+    hld.vertex_ids_.assign(forest.get_vertex_ids().begin(), forest.get_vertex_ids().end());
+    hld.index_.reserve(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        hld.index_[hld.vertex_ids_[i]] = i;
+    }
+
+    hld.parents_.assign(n, none);
+    hld.depths_.assign(n, 0);
+    hld.roots_.assign(n, none);
+    hld.heads_.assign(n, none);
+    hld.positions_.assign(n, 0);
+
+    // Pass 1: iterative DFS for parents, depths and a preorder; subtree sizes and heavy children are
+    // then accumulated in reverse preorder
+    std::vector<uint32_t> preorder;
+    preorder.reserve(n);
+    std::vector<WeightType> parent_weights(n, 0);
+    std::vector<uint32_t> stack;
+
+    auto discover = [&](uint32_t tree_root) {
+        hld.parents_[tree_root] = tree_root;
+        hld.roots_[tree_root] = tree_root;
+        stack.assign(1, tree_root);
+        while (!stack.empty()) {
+            uint32_t current = stack.back();
+            stack.pop_back();
+            preorder.push_back(current);
+
+            auto row = forest.neighbors(current);
+            auto weights = forest.weights(current);
+            for (size_t k = 0; k < row.size(); ++k) {
+                uint32_t neighbor = row[k];
+                if (neighbor == hld.parents_[current] && current != tree_root) {
+                    continue;
+                }
+                if (hld.parents_[neighbor] != none) {
+                    throw std::runtime_error("Graph is not a forest");
+                }
+                hld.parents_[neighbor] = current;
+                hld.depths_[neighbor] = hld.depths_[current] + 1;
+                hld.roots_[neighbor] = tree_root;
+                parent_weights[neighbor] = weights[k];
+                stack.push_back(neighbor);
+            }
+        }
+    };
+
+    if (first_root < n) {
+        discover(first_root);
+    }
+    for (uint32_t v = 0; v < n; ++v) {
+        if (hld.parents_[v] == none) {
+            discover(v);
+        }
+    }
+
+    std::vector<uint32_t> sizes(n, 1);
+    std::vector<uint32_t> heavy(n, none);
+    for (size_t i = n; i-- > 0;) {
+        uint32_t v = preorder[i];
+        uint32_t parent = hld.parents_[v];
+        if (parent == v) {
+            continue;
+        }
+        sizes[parent] += sizes[v];
+        if (heavy[parent] == none || sizes[v] > sizes[heavy[parent]]) {
+            heavy[parent] = v;
+        }
+    }
+
+    // Pass 2: preorder again, heavy child popped right after its parent so chains stay contiguous
+    uint32_t next_position = 0;
+    for (uint32_t tree_root : preorder) {
+        if (hld.parents_[tree_root] != tree_root) {
+            continue;
+        }
+        hld.heads_[tree_root] = tree_root;
+        stack.assign(1, tree_root);
+        while (!stack.empty()) {
+            uint32_t current = stack.back();
+            stack.pop_back();
+            hld.positions_[current] = next_position++;
+
+            for (uint32_t neighbor : forest.neighbors(current)) {
+                if (hld.parents_[neighbor] == current && neighbor != heavy[current]) {
+                    hld.heads_[neighbor] = neighbor;
+                    stack.push_back(neighbor);
+                }
+            }
+            if (heavy[current] != none) {
+                hld.heads_[heavy[current]] = hld.heads_[current];
+                stack.push_back(heavy[current]);
+            }
+        }
+    }
+
+    hld.sums_.assign(2 * n, 0);
+    hld.maxima_.assign(2 * n, lowest);
+    for (uint32_t v = 0; v < n; ++v) {
+        if (hld.parents_[v] != v) {
+            hld.sums_[n + hld.positions_[v]] = parent_weights[v];
+            hld.maxima_[n + hld.positions_[v]] = parent_weights[v];
+        }
+    }
+    for (size_t node = n; node-- > 1;) {
+        hld.sums_[node] = hld.sums_[2 * node] + hld.sums_[2 * node + 1];
+        hld.maxima_[node] = std::max(hld.maxima_[2 * node], hld.maxima_[2 * node + 1]);
+    }
+
+    return hld;
+}
+
+
+template <typename VertexId, typename WeightType>
+uint32_t HeavyLightDecomposition<VertexId, WeightType>::index_of(const VertexId& id) const {
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename VertexId, typename WeightType>
+uint32_t HeavyLightDecomposition<VertexId, WeightType>::child_of_edge(const VertexId& u, const VertexId& v) const {
+    uint32_t a = index_of(u);
+    uint32_t b = index_of(v);
+    if (a != b && parents_[a] == b) {
+        return a;
+    }
+    if (a != b && parents_[b] == a) {
+        return b;
+    }
+    throw std::invalid_argument("Edge does not exist");
+}
+
+template <typename VertexId, typename WeightType>
+void HeavyLightDecomposition<VertexId, WeightType>::update(uint32_t position, WeightType weight) {
+    const size_t n = vertex_ids_.size();
+    size_t node = n + position;
+    sums_[node] = weight;
+    maxima_[node] = weight;
+    for (node >>= 1; node >= 1; node >>= 1) {
+        sums_[node] = sums_[2 * node] + sums_[2 * node + 1];
+        maxima_[node] = std::max(maxima_[2 * node], maxima_[2 * node + 1]);
+    }
+}
+
+template <typename VertexId, typename WeightType>
+std::pair<WeightType, WeightType> HeavyLightDecomposition<VertexId, WeightType>::range(uint32_t first,
+                                                                                        uint32_t last) const {
+    const size_t n = vertex_ids_.size();
+    WeightType sum = 0;
+    WeightType max = lowest;
+    for (size_t left = n + first, right = n + last + 1; left < right; left >>= 1, right >>= 1) {
+        if (left & 1) {
+            sum += sums_[left];
+            max = std::max(max, maxima_[left]);
+            ++left;
+        }
+        if (right & 1) {
+            --right;
+            sum += sums_[right];
+            max = std::max(max, maxima_[right]);
+        }
+    }
+    return {sum, max};
+}
+
+template <typename VertexId, typename WeightType>
+std::optional<std::pair<WeightType, WeightType>> HeavyLightDecomposition<VertexId, WeightType>::path(
+        const VertexId& u, const VertexId& v) const {
+    uint32_t a = index_of(u);
+    uint32_t b = index_of(v);
+    if (roots_[a] != roots_[b]) {
+        return std::nullopt;
+    }
+
+    WeightType sum = 0;
+    WeightType max = lowest;
+    auto add = [&](std::pair<WeightType, WeightType> part) {
+        sum += part.first;
+        max = std::max(max, part.second);
+    };
+
+    // Climb from the endpoint with the deeper chain head until both are on one chain
+    while (heads_[a] != heads_[b]) {
+        if (depths_[heads_[a]] < depths_[heads_[b]]) {
+            std::swap(a, b);
+        }
+        add(range(positions_[heads_[a]], positions_[a]));
+        a = parents_[heads_[a]];
+    }
+
+    // The shallower one is the LCA, whose own position holds the edge above it
+    if (depths_[a] > depths_[b]) {
+        std::swap(a, b);
+    }
+    if (a != b) {
+        add(range(positions_[a] + 1, positions_[b]));
+    }
+    return std::make_pair(sum, max);
+}
+
+template <typename VertexId, typename WeightType>
+std::optional<WeightType> HeavyLightDecomposition<VertexId, WeightType>::path_sum(const VertexId& u,
+                                                                                  const VertexId& v) const {
+    auto result = path(u, v);
+    if (!result) {
+        return std::nullopt;
+    }
+    return result->first;
+}
+
+template <typename VertexId, typename WeightType>
+std::optional<WeightType> HeavyLightDecomposition<VertexId, WeightType>::path_max(const VertexId& u,
+                                                                                  const VertexId& v) const {
+    auto result = path(u, v);
+    if (!result) {
+        return std::nullopt;
+    }
+    return result->second;
+}
+
+template <typename VertexId, typename WeightType>
+WeightType HeavyLightDecomposition<VertexId, WeightType>::edge_weight(const VertexId& u, const VertexId& v) const {
+    return sums_[vertex_ids_.size() + positions_[child_of_edge(u, v)]];
+}
+
+template <typename VertexId, typename WeightType>
+void HeavyLightDecomposition<VertexId, WeightType>::set_edge_weight(const VertexId& u, const VertexId& v,
+                                                                    WeightType weight) {
+    update(positions_[child_of_edge(u, v)], weight);
+}
@@ -0,0 +1,137 @@
+#include "../include/json_stream.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+
+template <typename GraphType, typename VertexId, typename WeightType>
+void GraphJsonSax<GraphType, VertexId, WeightType>::ensure_vertex(const VertexId& id) {
+    // "edges" comes before "vertices", so endpoints may show up before their vertex entry
+    if (!graph_.has_vertex(id)) {
+        graph_.add_vertex(id);
+        implicit_vertices_.insert(id);
+    }
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+void GraphJsonSax<GraphType, VertexId, WeightType>::add_vertex_entry(const VertexId& id) {
+    // An entry may claim a vertex its edges created; any other repeat throws like Graph::add_vertex
+    if (implicit_vertices_.erase(id) == 0) {
+        graph_.add_vertex(id);
+    }
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::scalar(json value) {
+    if (depth_ == 1 && key_ == "vertex_count" && value.is_number_unsigned()) {
+        graph_.reserve_vertices(std::min(value.template get<size_t>(), reserve_limit_));
+        return true;
+    }
+    if (depth_ != 3) {
+        return true;
+    }
+
+    if (section_ == Section::vertices && key_ == "id") {
+        id_ = value.template get<VertexId>();
+    } else if (section_ == Section::edges && key_ == "from") {
+        from_ = value.template get<VertexId>();
+    } else if (section_ == Section::edges && key_ == "to") {
+        to_ = value.template get<VertexId>();
+    } else if (section_ == Section::edges && key_ == "weight") {
+        weight_ = value.template get<WeightType>();
+    }
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::null() {
+    return scalar(nullptr);
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::boolean(bool value) {
+    return scalar(value);
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::number_integer(number_integer_t value) {
+    return scalar(value);
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::number_unsigned(number_unsigned_t value) {
+    return scalar(value);
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::number_float(number_float_t value, const string_t&) {
+    return scalar(value);
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::string(string_t& value) {
+    return scalar(std::move(value));
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::binary(binary_t&) {
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::start_object(std::size_t) {
+    ++depth_;
+    if (depth_ == 3) {
+        id_.reset();
+        from_.reset();
+        to_.reset();
+        weight_.reset();
+    }
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::key(string_t& value) {
+    if (depth_ == 1) {
+        section_ = value == "vertices" ? Section::vertices :
+                   value == "edges" ? Section::edges : Section::other;
+    }
+    key_ = value;
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::end_object() {
+    if (depth_ == 3 && section_ == Section::vertices) {
+        if (!id_) {
+            throw std::runtime_error("Malformed vertex entry in JSON");
+        }
+        add_vertex_entry(*id_);
+    } else if (depth_ == 3 && section_ == Section::edges) {
+        if (!from_ || !to_ || !weight_) {
+            throw std::runtime_error("Malformed edge entry in JSON");
+        }
+        ensure_vertex(*from_);
+        ensure_vertex(*to_);
+        graph_.add_edge(*from_, *to_, *weight_);
+    }
+    --depth_;
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::start_array(std::size_t) {
+    ++depth_;
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::end_array() {
+    --depth_;
+    return true;
+}
+
+template <typename GraphType, typename VertexId, typename WeightType>
+bool GraphJsonSax<GraphType, VertexId, WeightType>::parse_error(std::size_t, const std::string&,
+                                                               const nlohmann::detail::exception& error) {
+    throw std::runtime_error(std::string("Unable to parse graph JSON: ") + error.what());
+}
@@ -0,0 +1,236 @@
+#include "../include/lca_index.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+
+template <typename VertexId>
+template <typename WeightType>
+LcaIndex<VertexId> LcaIndex<VertexId>::build(const CsrGraph<VertexId, WeightType>& forest) {
+    return build_from(forest, 0);
+}
+
+template <typename VertexId>
+template <typename WeightType>
+LcaIndex<VertexId> LcaIndex<VertexId>::build(const CsrGraph<VertexId, WeightType>& forest, const VertexId& root) {
+    if (!forest.has_vertex(root)) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return build_from(forest, forest.index_of(root));
+}
+
+template <typename VertexId>
+template <typename WeightType>
+LcaIndex<VertexId> LcaIndex<VertexId>::build_from(const CsrGraph<VertexId, WeightType>& forest, uint32_t first_root) {
+    const size_t n = forest.vertex_count();
+
+    LcaIndex index;
+    index.vertex_ids_.assign(forest.get_vertex_ids().begin(), forest.get_vertex_ids().end());
+    index.index_.reserve(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        index.index_[index.vertex_ids_[i]] = i;
+    }
+
+    index.parents_.assign(n, none);
+    index.depths_.assign(n, 0);
+    index.roots_.assign(n, none);
+    index.first_.assign(n, 0);
+    index.last_.assign(n, 0);
+    index.euler_.reserve(n == 0 ? 0 : 2 * n - 1);
+
+    auto& euler = index.euler_;
+    std::vector<size_t> cursors(n);
+    std::vector<uint32_t> stack;
+
+    auto visit = [&](uint32_t vertex) {
+        index.last_[vertex] = static_cast<uint32_t>(euler.size());
+        euler.push_back(vertex);
+    };
+
+    // Iterative DFS; the tour records a vertex on entry and again after each child
+    auto tour_tree = [&](uint32_t root) {
+        index.parents_[root] = root;
+        index.roots_[root] = root;
+        index.first_[root] = static_cast<uint32_t>(euler.size());
+        visit(root);
+        cursors[root] = forest.get_offsets()[root];
+        stack.assign(1, root);
+
+        while (!stack.empty()) {
+            uint32_t current = stack.back();
+            if (cursors[current] == forest.get_offsets()[current + 1]) {
+                stack.pop_back();
+                if (!stack.empty()) {
+                    visit(stack.back());
+                }
+                continue;
+            }
+
+            uint32_t neighbor = forest.get_neighbors()[cursors[current]++];
+            if (neighbor == index.parents_[current] && current != root) {
+                continue;
+            }
+            if (index.parents_[neighbor] != none) {
+                throw std::runtime_error("Graph is not a forest");
+            }
+
+            index.parents_[neighbor] = current;
+            index.depths_[neighbor] = index.depths_[current] + 1;
+            index.roots_[neighbor] = root;
+            index.first_[neighbor] = static_cast<uint32_t>(euler.size());
+            visit(neighbor);
+            cursors[neighbor] = forest.get_offsets()[neighbor];
+            stack.push_back(neighbor);
+        }
+    };
+
+    if (n > 0) {
+        tour_tree(first_root);
+    }
+    for (uint32_t root = 0; root < n; ++root) {
+        if (index.parents_[root] == none) {
+            tour_tree(root);
+        }
+    }
+
+    const size_t tour_size = euler.size();
+    const size_t sparse_levels = std::bit_width(tour_size);
+    index.sparse_.resize(sparse_levels * tour_size);
+    std::copy(euler.begin(), euler.end(), index.sparse_.begin());
+    for (size_t k = 1; k < sparse_levels; ++k) {
+        const size_t half = size_t(1) << (k - 1);
+        const uint32_t* previous = index.sparse_.data() + (k - 1) * tour_size;
+        uint32_t* current = index.sparse_.data() + k * tour_size;
+        for (size_t i = 0; i + 2 * half <= tour_size; ++i) {
+            current[i] = index.shallower(previous[i], previous[i + half]);
+        }
+    }
+
+    const size_t up_levels = std::max<size_t>(1, std::bit_width(n));
+    index.up_.resize(up_levels * n);
+    std::copy(index.parents_.begin(), index.parents_.end(), index.up_.begin());
+    for (size_t k = 1; k < up_levels; ++k) {
+        const uint32_t* previous = index.up_.data() + (k - 1) * n;
+        uint32_t* current = index.up_.data() + k * n;
+        for (size_t v = 0; v < n; ++v) {
+            current[v] = previous[previous[v]];
+        }
+    }
+
+    return index;
+}
+
+
+template <typename VertexId>
+uint32_t LcaIndex<VertexId>::index_of(const VertexId& id) const {
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        throw std::invalid_argument("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename VertexId>
+uint32_t LcaIndex<VertexId>::lca_index(uint32_t u, uint32_t v) const {
+    if (roots_[u] != roots_[v]) {
+        return none;
+    }
+
+    size_t left = std::min(first_[u], first_[v]);
+    size_t right = std::max(first_[u], first_[v]);
+    size_t k = std::bit_width(right - left + 1) - 1;
+    const uint32_t* level = sparse_.data() + k * euler_.size();
+    return shallower(level[left], level[right + 1 - (size_t(1) << k)]);
+}
+
+template <typename VertexId>
+std::optional<VertexId> LcaIndex<VertexId>::lca(const VertexId& u, const VertexId& v) const {
+    uint32_t result = lca_index(index_of(u), index_of(v));
+    if (result == none) {
+        return std::nullopt;
+    }
+    return vertex_ids_[result];
+}
+
+template <typename VertexId>
+std::vector<std::optional<VertexId>> LcaIndex<VertexId>::lca(
+        std::span<const std::pair<VertexId, VertexId>> queries) const {
+    const size_t n = vertex_ids_.size();
+
+    // Queries grouped by both ends in CSR form
+    std::vector<uint32_t> ends(2 * queries.size());
+    std::vector<size_t> offsets(n + 1, 0);
+    for (size_t q = 0; q < queries.size(); ++q) {
+        ends[2 * q] = index_of(queries[q].first);
+        ends[2 * q + 1] = index_of(queries[q].second);
+        ++offsets[ends[2 * q] + 1];
+        ++offsets[ends[2 * q + 1] + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<size_t> by_vertex(ends.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t end = 0; end < ends.size(); ++end) {
+        by_vertex[cursor[ends[end]]++] = end / 2;
+    }
+
+    std::vector<std::optional<VertexId>> result(queries.size());
+    std::vector<bool> finished(n, false);
+    std::vector<uint32_t> ancestors(n);
+    DisjointSets sets(n);
+
+    // Walking the tour replays the DFS: a vertex is finished at its last occurrence, and then every
+    // finished vertex u of the same tree has ancestors[find(u)] == lca(u, v)
+    for (size_t position = 0; position < euler_.size(); ++position) {
+        uint32_t vertex = euler_[position];
+        if (position != last_[vertex]) {
+            continue;
+        }
+
+        finished[vertex] = true;
+        ancestors[sets.find(vertex)] = vertex;
+        for (size_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+            size_t q = by_vertex[i];
+            uint32_t other = ends[2 * q] == vertex ? ends[2 * q + 1] : ends[2 * q];
+            if (finished[other] && roots_[other] == roots_[vertex]) {
+                result[q] = vertex_ids_[ancestors[sets.find(other)]];
+            }
+        }
+
+        uint32_t parent = parents_[vertex];
+        if (parent != vertex) {
+            sets.unite(vertex, parent);
+            ancestors[sets.find(parent)] = parent;
+        }
+    }
+
+    return result;
+}
+
+template <typename VertexId>
+std::optional<VertexId> LcaIndex<VertexId>::ancestor(const VertexId& vertex, size_t k) const {
+    uint32_t current = index_of(vertex);
+    if (k > depths_[current]) {
+        return std::nullopt;
+    }
+
+    const size_t n = vertex_ids_.size();
+    for (size_t level = 0; k > 0; ++level, k >>= 1) {
+        if (k & 1) {
+            current = up_[level * n + current];
+        }
+    }
+    return vertex_ids_[current];
+}
+
+template <typename VertexId>
+std::optional<size_t> LcaIndex<VertexId>::distance(const VertexId& u, const VertexId& v) const {
+    uint32_t a = index_of(u);
+    uint32_t b = index_of(v);
+    uint32_t common = lca_index(a, b);
+    if (common == none) {
+        return std::nullopt;
+    }
+    return size_t(depths_[a]) + depths_[b] - 2 * size_t(depths_[common]);
+}
@@ -338,7 +338,7 @@ private:
         std::cin >> start;
 
         try {
-            graph_->greedy_coloring(start);
+            graph_->export_greedy_coloring(graph_->greedy_coloring(start));
             std::cout << "\nGreedy coloring completed successfully!" << std::endl;
             run_visualization("greedy_coloring_visualization.py");
         } catch (const std::exception& e) {
@@ -357,7 +357,7 @@ private:
         std::cin >> start;
 
         try {
-            graph_->dijkstra(start);
+            graph_->export_dijkstra(graph_->dijkstra<RadixHeap>(start));
             std::cout << "\nDijkstra's algorithm completed successfully!" << std::endl;
             run_visualization("dijkstra_visualization.py");
         } catch (const std::exception& e) {
@@ -376,7 +376,7 @@ private:
         std::cin >> start;
 
         try {
-            graph_->shortest_paths_unweighted(start);
+            graph_->export_shortest_paths_unweighted(graph_->shortest_paths_unweighted(start));
             std::cout << "\nShortest paths calculation completed successfully!" << std::endl;
             run_visualization("shortest_paths_visualization.py");
         } catch (const std::exception& e) {
@@ -418,7 +418,7 @@ private:
         std::cin >> start;
 
         try {
-            graph_->breadth_first_search(start);
+            graph_->export_bfs(graph_->breadth_first_search(start));
             std::cout << "\nBFS completed successfully!" << std::endl;
             run_visualization("bfs_visualization.py");
         } catch (const std::exception& e) {
@@ -437,7 +437,7 @@ private:
         std::cin >> start;
 
         try {
-            graph_->depth_first_search(start);
+            graph_->export_dfs(graph_->depth_first_search(start));
             std::cout << "\nDFS completed successfully!" << std::endl;
             run_visualization("dfs_visualization.py");
         } catch (const std::exception& e) {
@@ -452,6 +452,7 @@ private:
         }
         try {
             auto components = graph_->find_connected_components();
+            graph_->export_components(components);
             std::cout << "\nFound " << components.size() << " components!" << std::endl;
             run_visualization("find_components.py");
         } catch (const std::exception& e) {
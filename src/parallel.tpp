@@ -0,0 +1,75 @@
+#include "../include/parallel.hpp"
+#include <algorithm>
+#include <thread>
+
+
+inline size_t default_thread_count() {
+    size_t hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
+
+template <typename Function>
+void parallel_for(size_t count, size_t thread_count, Function&& function) {
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+    thread_count = std::max<size_t>(1, std::min(thread_count, count));
+
+    if (thread_count == 1) {
+        function(size_t(0), count, size_t(0));
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count - 1);
+
+    size_t chunk = (count + thread_count - 1) / thread_count;
+    for (size_t worker = 1; worker < thread_count; ++worker) {
+        size_t begin = std::min(count, worker * chunk);
+        size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([&function, begin, end, worker]() { function(begin, end, worker); });
+    }
+
+    // The calling thread takes the first chunk itself
+    function(size_t(0), std::min(count, chunk), size_t(0));
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T>& data, Compare compare, size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = default_thread_count();
+    }
+    thread_count = std::max<size_t>(1, std::min(thread_count, data.size()));
+
+    if (thread_count == 1) {
+        std::sort(data.begin(), data.end(), compare);
+        return;
+    }
+
+    size_t chunk = (data.size() + thread_count - 1) / thread_count;
+
+    parallel_for(thread_count, thread_count, [&](size_t begin, size_t end, size_t) {
+        for (size_t part = begin; part < end; ++part) {
+            auto first = data.begin() + std::min(data.size(), part * chunk);
+            auto last = data.begin() + std::min(data.size(), (part + 1) * chunk);
+            std::sort(first, last, compare);
+        }
+    });
+
+    // Merge neighbouring sorted runs, doubling the run width every round
+    for (size_t width = chunk; width < data.size(); width *= 2) {
+        size_t pairs = (data.size() + 2 * width - 1) / (2 * width);
+        parallel_for(pairs, thread_count, [&](size_t begin, size_t end, size_t) {
+            for (size_t pair = begin; pair < end; ++pair) {
+                size_t lo = pair * 2 * width;
+                size_t mid = std::min(data.size(), lo + width);
+                size_t hi = std::min(data.size(), lo + 2 * width);
+                std::inplace_merge(data.begin() + lo, data.begin() + mid, data.begin() + hi, compare);
+            }
+        });
+    }
+}
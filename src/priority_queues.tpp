@@ -0,0 +1,221 @@
+#include "../include/priority_queues.hpp"
+#include <bit>
+#include <stdexcept>
+
+
+template <typename WeightType>
+void LazyPriorityQueue<WeightType>::push(uint32_t vertex, WeightType distance) {
+    queue_.push(distance, {distance, vertex}); // Pass priority and item
+}
+
+template <typename WeightType>
+void LazyPriorityQueue<WeightType>::reset(size_t, WeightType) {
+    while (!queue_.empty()) {
+        queue_.pop();
+    }
+}
+
+template <typename WeightType>
+std::pair<WeightType, uint32_t> LazyPriorityQueue<WeightType>::pop() {
+    auto entry = queue_.top().item;
+    queue_.pop();
+    return {entry.first_, entry.second_};
+}
+
+
+template <typename WeightType>
+void BinaryHeap<WeightType>::reset(size_t, WeightType) {
+    while (!queue_.empty()) {
+        queue_.pop();
+    }
+}
+
+template <typename WeightType>
+std::pair<WeightType, uint32_t> BinaryHeap<WeightType>::pop() {
+    auto entry = queue_.top();
+    queue_.pop();
+    return entry;
+}
+
+
+template <typename WeightType, size_t Arity>
+IndexedDaryHeap<WeightType, Arity>::IndexedDaryHeap(size_t vertex_count, WeightType) :
+    position_(vertex_count, absent) {}
+
+template <typename WeightType, size_t Arity>
+void IndexedDaryHeap<WeightType, Arity>::reset(size_t vertex_count, WeightType) {
+    for (const auto& entry : heap_) {
+        position_[entry.second] = absent;
+    }
+    heap_.clear();
+    if (position_.size() < vertex_count) {
+        position_.resize(vertex_count, absent);
+    }
+}
+
+template <typename WeightType, size_t Arity>
+void IndexedDaryHeap<WeightType, Arity>::place(size_t index, std::pair<WeightType, uint32_t> entry) {
+    position_[entry.second] = static_cast<uint32_t>(index);
+    heap_[index] = entry;
+}
+
+template <typename WeightType, size_t Arity>
+void IndexedDaryHeap<WeightType, Arity>::sift_up(size_t index) {
+    auto entry = heap_[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / Arity;
+        if (!(entry.first < heap_[parent].first)) {
+            break;
+        }
+        place(index, heap_[parent]);
+        index = parent;
+    }
+    place(index, entry);
+}
+
+template <typename WeightType, size_t Arity>
+void IndexedDaryHeap<WeightType, Arity>::sift_down(size_t index) {
+    auto entry = heap_[index];
+    while (true) {
+        size_t first_child = index * Arity + 1;
+        if (first_child >= heap_.size()) {
+            break;
+        }
+
+        size_t best = first_child;
+        size_t last_child = std::min(first_child + Arity, heap_.size());
+        for (size_t child = first_child + 1; child < last_child; ++child) {
+            if (heap_[child].first < heap_[best].first) {
+                best = child;
+            }
+        }
+
+        if (!(heap_[best].first < entry.first)) {
+            break;
+        }
+        place(index, heap_[best]);
+        index = best;
+    }
+    place(index, entry);
+}
+
+template <typename WeightType, size_t Arity>
+void IndexedDaryHeap<WeightType, Arity>::push(uint32_t vertex, WeightType distance) {
+    if (contains(vertex)) {
+        size_t index = position_[vertex];
+        if (distance < heap_[index].first) {
+            heap_[index].first = distance;
+            sift_up(index);
+        }
+        return;
+    }
+
+    heap_.push_back({distance, vertex});
+    sift_up(heap_.size() - 1);
+}
+
+template <typename WeightType, size_t Arity>
+std::pair<WeightType, uint32_t> IndexedDaryHeap<WeightType, Arity>::pop() {
+    auto top = heap_.front();
+    position_[top.second] = absent;
+
+    auto last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+        heap_.front() = last;
+        sift_down(0);
+    }
+    return top;
+}
+
+
+template <typename WeightType>
+size_t RadixHeap<WeightType>::bucket_of(Key key, Key last) {
+    return key == last ? 0 : std::bit_width(static_cast<Key>(key ^ last));
+}
+
+template <typename WeightType>
+void RadixHeap<WeightType>::reset(size_t, WeightType) {
+    for (auto& bucket : buckets_) {
+        bucket.clear();
+    }
+    last_ = 0;
+    size_ = 0;
+}
+
+template <typename WeightType>
+void RadixHeap<WeightType>::push(uint32_t vertex, WeightType distance) {
+    Key key = static_cast<Key>(distance);
+    if (key < last_) {
+        throw std::logic_error("RadixHeap keys must not go below the last popped key");
+    }
+    buckets_[bucket_of(key, last_)].push_back({key, vertex});
+    ++size_;
+}
+
+template <typename WeightType>
+std::pair<WeightType, uint32_t> RadixHeap<WeightType>::pop() {
+    if (buckets_[0].empty()) {
+        size_t index = 1;
+        while (buckets_[index].empty()) {
+            ++index;
+        }
+
+        // The new minimum becomes the reference point; every entry of that bucket moves strictly lower
+        auto& bucket = buckets_[index];
+        Key minimum = bucket.front().first;
+        for (const auto& entry : bucket) {
+            minimum = std::min(minimum, entry.first);
+        }
+        last_ = minimum;
+        for (const auto& entry : bucket) {
+            buckets_[bucket_of(entry.first, last_)].push_back(entry);
+        }
+        bucket.clear();
+    }
+
+    auto entry = buckets_[0].back();
+    buckets_[0].pop_back();
+    --size_;
+    return {static_cast<WeightType>(entry.first), entry.second};
+}
+
+
+template <typename WeightType>
+DialBuckets<WeightType>::DialBuckets(size_t, WeightType max_weight) :
+    buckets_(static_cast<size_t>(max_weight) + 1) {}
+
+template <typename WeightType>
+void DialBuckets<WeightType>::reset(size_t, WeightType max_weight) {
+    if (buckets_.size() != static_cast<size_t>(max_weight) + 1) {
+        buckets_.assign(static_cast<size_t>(max_weight) + 1, {});
+    } else if (size_ > 0) {
+        for (auto& bucket : buckets_) {
+            bucket.clear();
+        }
+    }
+    current_ = 0;
+    size_ = 0;
+}
+
+template <typename WeightType>
+void DialBuckets<WeightType>::push(uint32_t vertex, WeightType distance) {
+    if (distance < current_ || distance - current_ >= static_cast<WeightType>(buckets_.size())) {
+        throw std::logic_error("DialBuckets distance outside of the bucket ring");
+    }
+    buckets_[static_cast<size_t>(distance) % buckets_.size()].push_back(vertex);
+    ++size_;
+}
+
+template <typename WeightType>
+std::pair<WeightType, uint32_t> DialBuckets<WeightType>::pop() {
+    while (buckets_[static_cast<size_t>(current_) % buckets_.size()].empty()) {
+        ++current_;
+    }
+
+    auto& bucket = buckets_[static_cast<size_t>(current_) % buckets_.size()];
+    uint32_t vertex = bucket.back();
+    bucket.pop_back();
+    --size_;
+    return {current_, vertex};
+}
@@ -0,0 +1,65 @@
+#include "../include/workspace.hpp"
+#include <algorithm>
+#include <limits>
+
+
+template <typename VertexId, typename WeightType>
+AlgorithmWorkspace<VertexId, WeightType>::AlgorithmWorkspace(size_t slot_count) {
+    begin(slot_count);
+}
+
+template <typename VertexId, typename WeightType>
+void AlgorithmWorkspace<VertexId, WeightType>::begin(size_t slot_count) {
+    if (slot_count != slot_count_ || stamps_.size() != slot_count) {
+        slot_count_ = slot_count;
+        stamps_.assign(slot_count, 0);
+        discovery_times_.resize(slot_count);
+        finish_times_.resize(slot_count);
+        distances_.resize(slot_count);
+        previous_.resize(slot_count);
+        states_.resize(slot_count);
+        colors_.resize(slot_count);
+        palette_.assign(slot_count / 64 + 1, 0);
+        degrees_.resize(slot_count);
+        cursors_.resize(slot_count);
+        epoch_ = 0;
+    }
+
+    // Stamps are cleared once every 2^32 - 1 queries, when the epoch wraps around
+    if (++epoch_ == 0) {
+        std::fill(stamps_.begin(), stamps_.end(), 0);
+        epoch_ = 1;
+    }
+
+    order_.clear();
+    stack_.clear();
+}
+
+template <typename VertexId, typename WeightType>
+void AlgorithmWorkspace<VertexId, WeightType>::touch(uint32_t slot) {
+    if (stamps_[slot] == epoch_) {
+        return;
+    }
+    stamps_[slot] = epoch_;
+    discovery_times_[slot] = -1;
+    finish_times_[slot] = -1;
+    distances_[slot] = std::numeric_limits<WeightType>::max();
+    previous_[slot] = slot;
+    states_[slot] = 0;
+    colors_[slot] = std::numeric_limits<size_t>::max();
+}
+
+template <typename VertexId, typename WeightType>
+template <typename Queue>
+Queue& AlgorithmWorkspace<VertexId, WeightType>::queue(size_t vertex_count, WeightType max_weight) {
+    if (queue_ && *queue_type_ == typeid(Queue)) {
+        Queue& reused = *static_cast<Queue*>(queue_.get());
+        reused.reset(vertex_count, max_weight);
+        return reused;
+    }
+
+    queue_ = std::unique_ptr<void, void (*)(void*)>(new Queue(vertex_count, max_weight),
+                                                     [](void* queue) { delete static_cast<Queue*>(queue); });
+    queue_type_ = &typeid(Queue);
+    return *static_cast<Queue*>(queue_.get());
+}
@@ -185,3 +185,42 @@ TEST_F(GraphTest, ClearGraph) {
     EXPECT_EQ(graph.vertex_count(), 0);
     EXPECT_EQ(graph.edge_count(), 0);
 }
+
+
+TEST_F(GraphTest, SlotsStayDenseAfterRemoval) {
+    User user3("Charlie", 35, "charlie@mail.com");
+    User user4("Dave", 40, "dave@mail.com");
+    graph.add_vertex(3, user3);
+    graph.add_vertex(4, user4);
+    graph.add_edge(1, 2, 1);
+    graph.add_edge(2, 3, 1);
+    graph.add_edge(3, 4, 1);
+
+    // Removing an early vertex moves the last one into its slot
+    graph.remove_vertex(1);
+
+    EXPECT_EQ(graph.vertex_count(), 3);
+    for (uint32_t slot = 0; slot < graph.vertex_count(); ++slot) {
+        EXPECT_EQ(graph.get_slot(graph.get_slot_id(slot)), slot);
+    }
+    EXPECT_THROW(graph.get_slot(1), std::invalid_argument);
+
+    // Slots cached on edges follow the moved vertex
+    const auto& edge = graph.get_edge(3, 4);
+    EXPECT_EQ(edge.get_from_slot(), graph.get_slot(3));
+    EXPECT_EQ(edge.get_to_slot(), graph.get_slot(4));
+
+    graph.breadth_first_search(2);
+    EXPECT_EQ(graph.get_vertex(2).get_discovery_time(), 0);
+    EXPECT_EQ(graph.get_vertex(3).get_discovery_time(), 1);
+    EXPECT_EQ(graph.get_vertex(4).get_discovery_time(), 3);
+}
+
+TEST_F(GraphTest, CopyDoesNotShareEdges) {
+    graph.add_edge(1, 2, 10);
+    Graph<int, User, int> g2(graph);
+
+    g2.set_edge_weight(1, 2, 20);
+    EXPECT_EQ(graph.get_edge(1, 2).get_weight(), 10);
+    EXPECT_EQ(g2.get_edge(2, 1).get_weight(), 20);
+}
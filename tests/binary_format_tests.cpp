@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "../include/graph.hpp"
+
+class BinaryFormatTest : public ::testing::Test {
+protected:
+    Graph<int, int, double> graph;
+    const std::string filename = "binary_format_test.bin";
+
+    void SetUp() override {
+        for (int i = 0; i < 6; ++i) {
+            graph.add_vertex(i * 10, i * 100);
+        }
+        graph.add_vertex(60); // no data
+        graph.add_edge(0, 10, 1.5);
+        graph.add_edge(10, 20, 2.5);
+        graph.add_edge(20, 30, 0.5);
+        graph.add_edge(0, 30, 4.0);
+        graph.add_edge(40, 50, 7.0);
+    }
+
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+
+    std::string read_file() const {
+        std::ifstream file(filename, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    void write_file(const std::string& bytes) const {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+};
+
+TEST_F(BinaryFormatTest, MappedGraphMatchesSnapshot) {
+    graph.save_to_binary(filename);
+
+    auto frozen = graph.freeze();
+    auto mapped = CsrGraph<int, double>::map_binary(filename);
+
+    EXPECT_TRUE(mapped.is_mapped());
+    EXPECT_FALSE(frozen.is_mapped());
+    ASSERT_EQ(mapped.vertex_count(), frozen.vertex_count());
+    EXPECT_EQ(mapped.edge_count(), frozen.edge_count());
+
+    for (uint32_t v = 0; v < frozen.vertex_count(); ++v) {
+        EXPECT_EQ(mapped.id_of(v), frozen.id_of(v));
+        EXPECT_EQ(mapped.index_of(frozen.id_of(v)), v);
+        auto a = frozen.neighbors(v);
+        auto b = mapped.neighbors(v);
+        EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+        auto wa = frozen.weights(v);
+        auto wb = mapped.weights(v);
+        EXPECT_TRUE(std::equal(wa.begin(), wa.end(), wb.begin(), wb.end()));
+    }
+
+    // Algorithms run directly on the mapping
+    auto expected = frozen.dijkstra(0);
+    auto result = mapped.dijkstra(0);
+    EXPECT_EQ(result.distances, expected.distances);
+
+    ASSERT_NE(mapped.payload<int>(mapped.index_of(20)), nullptr);
+    EXPECT_EQ(*mapped.payload<int>(mapped.index_of(20)), 200);
+    EXPECT_EQ(mapped.payload<int>(mapped.index_of(60)), nullptr);
+}
+
+TEST_F(BinaryFormatTest, CopyOutlivesOriginal) {
+    graph.save_to_binary(filename);
+
+    CsrGraph<int, double> copy;
+    {
+        auto mapped = CsrGraph<int, double>::map_binary(filename);
+        copy = mapped;
+    }
+    EXPECT_EQ(copy.degree(copy.index_of(0)), 2);
+
+    CsrGraph<int, double> owned_copy;
+    {
+        auto frozen = graph.freeze();
+        owned_copy = frozen;
+    }
+    EXPECT_EQ(owned_copy.degree(owned_copy.index_of(10)), 2);
+}
+
+TEST_F(BinaryFormatTest, GraphRoundTrip) {
+    graph.save_to_binary(filename);
+
+    Graph<int, int, double> loaded;
+    loaded.add_vertex(999);
+    loaded.load_from_binary(filename);
+
+    EXPECT_EQ(loaded.vertex_count(), graph.vertex_count());
+    EXPECT_EQ(loaded.edge_count(), graph.edge_count());
+    EXPECT_FALSE(loaded.has_vertex(999));
+    EXPECT_EQ(*loaded.get_vertex(30).get_data(), 300);
+    EXPECT_TRUE(loaded.get_vertex(60).get_data() == nullptr);
+    EXPECT_DOUBLE_EQ(loaded.get_edge(0, 30).get_weight(), 4.0);
+
+    loaded.add_edge(50, 60, 1.0);
+    EXPECT_EQ(loaded.get_degree(60), 1);
+}
+
+TEST_F(BinaryFormatTest, SortedIdsSkipTheIndex) {
+    std::vector<std::tuple<int, int, double>> edges = {{5, 1, 1.0}, {1, 3, 2.0}, {3, 9, 3.0}};
+    auto csr = CsrGraph<int, double>::from_edge_list(edges);
+    csr.save_binary(filename);
+
+    auto mapped = CsrGraph<int, double>::map_binary(filename);
+    EXPECT_TRUE(mapped.has_vertex(9));
+    EXPECT_FALSE(mapped.has_vertex(4));
+    EXPECT_EQ(mapped.id_of(mapped.index_of(5)), 5);
+    EXPECT_THROW(mapped.index_of(4), std::invalid_argument);
+}
+
+TEST_F(BinaryFormatTest, RejectsBadFiles) {
+    EXPECT_THROW((CsrGraph<int, double>::map_binary("missing_graph_file.bin")), std::runtime_error);
+
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "definitely not a graph file, just some text that is long enough for a header......";
+    }
+    EXPECT_THROW((CsrGraph<int, double>::map_binary(filename)), std::runtime_error);
+
+    // Same layout read back with a different weight type
+    graph.save_to_binary(filename);
+    EXPECT_THROW((CsrGraph<int, float>::map_binary(filename)), std::runtime_error);
+}
+
+TEST_F(BinaryFormatTest, RejectsCountsThatOverflowSectionLengths) {
+    graph.save_to_binary(filename);
+    std::string bytes = read_file();
+
+    // 2^62 + 2 entries wrap both entry_count * 4 and entry_count * 8 around to a few bytes; the last
+    // offset is patched as well so that only the section bounds can catch it
+    GraphFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    const uint64_t entry_count = (uint64_t(1) << 62) + 2;
+    header.entry_count = entry_count;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + header.offsets_position + header.vertex_count * sizeof(size_t), &entry_count,
+                sizeof(entry_count));
+    write_file(bytes);
+
+    try {
+        CsrGraph<int, double>::map_binary(filename);
+        FAIL() << "a crafted entry count was accepted";
+    } catch (const std::runtime_error& error) {
+        EXPECT_NE(std::string(error.what()).find("section out of bounds"), std::string::npos);
+    }
+}
+
+TEST_F(BinaryFormatTest, RejectsCorruptInterior) {
+    graph.save_to_binary(filename);
+    const std::string original = read_file();
+    GraphFileHeader header;
+    std::memcpy(&header, original.data(), sizeof(header));
+
+    // An interior offset past its successor
+    std::string bytes = original;
+    const size_t too_far = header.entry_count;
+    std::memcpy(bytes.data() + header.offsets_position + sizeof(size_t), &too_far, sizeof(too_far));
+    write_file(bytes);
+    EXPECT_THROW((CsrGraph<int, double>::map_binary(filename)), std::runtime_error);
+    EXPECT_THROW(graph.load_from_binary(filename), std::runtime_error);
+
+    // A neighbor index outside the vertex range
+    bytes = original;
+    const uint32_t outside = static_cast<uint32_t>(header.vertex_count);
+    std::memcpy(bytes.data() + header.neighbors_position, &outside, sizeof(outside));
+    write_file(bytes);
+    EXPECT_THROW((CsrGraph<int, double>::map_binary(filename)), std::runtime_error);
+
+    // The unchecked mode accepts the same file
+    EXPECT_NO_THROW((CsrGraph<int, double>::map_binary(filename, true)));
+}
+
+TEST_F(BinaryFormatTest, SortedFlagIsRechecked) {
+    std::vector<std::tuple<int, int, double>> edges = {{5, 1, 1.0}, {9, 3, 2.0}};
+    auto csr = CsrGraph<int, double>::from_edge_list(edges);
+    csr.save_binary(filename);
+
+    // Swap the first and last id; the header still claims the ids are sorted
+    std::string bytes = read_file();
+    GraphFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    ASSERT_TRUE(header.flags & GraphFileHeader::sorted_ids);
+    char* ids = bytes.data() + header.ids_position;
+    std::swap_ranges(ids, ids + sizeof(int), ids + (header.vertex_count - 1) * sizeof(int));
+    write_file(bytes);
+
+    auto mapped = CsrGraph<int, double>::map_binary(filename);
+    for (int id : {1, 3, 5, 9}) {
+        ASSERT_TRUE(mapped.has_vertex(id));
+        EXPECT_EQ(mapped.id_of(mapped.index_of(id)), id);
+    }
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+// Components of the graph with one edge or one vertex left out
+static size_t count_components(const CsrGraph<int, int>& csr, std::pair<uint32_t, uint32_t> skipped_edge,
+                               uint32_t skipped_vertex) {
+    DisjointSets sets(csr.vertex_count());
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        for (uint32_t w : csr.neighbors(v)) {
+            if (v < w && std::make_pair(v, w) != skipped_edge && v != skipped_vertex && w != skipped_vertex) {
+                sets.unite(v, w);
+            }
+        }
+    }
+    return sets.set_count() - (skipped_vertex < csr.vertex_count());
+}
+
+static void expect_same_biconnectivity(const CsrBiconnectivity& a, const CsrBiconnectivity& b) {
+    EXPECT_EQ(a.bridges, b.bridges);
+    EXPECT_EQ(a.articulation_points, b.articulation_points);
+    EXPECT_EQ(a.two_edge_components.count, b.two_edge_components.count);
+    EXPECT_EQ(a.two_edge_components.labels, b.two_edge_components.labels);
+    EXPECT_EQ(a.block_count, b.block_count);
+    EXPECT_EQ(a.edge_blocks, b.edge_blocks);
+}
+
+TEST(BridgesTest, TrianglesJoinedByBridge) {
+    Graph<int, int, int> graph;
+    for (int i = 0; i < 6; ++i) {
+        graph.add_vertex(i, 0);
+    }
+    for (auto [u, v] : std::vector<std::pair<int, int>>{{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}}) {
+        graph.add_edge(u, v, 1);
+    }
+
+    auto result = graph.find_biconnected_components();
+    ASSERT_EQ(result.bridges.size(), 1);
+    EXPECT_EQ(result.bridges[0], std::make_pair(2, 3));
+    ASSERT_EQ(result.articulation_points.size(), 2);
+    EXPECT_EQ(result.articulation_points[0], 2);
+    EXPECT_EQ(result.articulation_points[1], 3);
+    EXPECT_EQ(result.two_edge_components.size(), 2);
+    EXPECT_EQ(result.blocks.size(), 3);
+
+    EXPECT_TRUE(graph.get_edge(2, 3).is_bridge());
+    EXPECT_TRUE(graph.get_edge(3, 2).is_bridge());
+    EXPECT_FALSE(graph.get_edge(0, 1).is_bridge());
+
+    // Closing the cycle clears the flag on the next run
+    graph.add_edge(0, 5, 1);
+    result = graph.find_biconnected_components();
+    EXPECT_TRUE(result.bridges.empty());
+    EXPECT_FALSE(graph.get_edge(2, 3).is_bridge());
+    EXPECT_EQ(result.blocks.size(), 1);
+}
+
+TEST(BridgesTest, TreeEdgesAreAllBridges) {
+    Graph<int, int, int> tree;
+    tree.generate_tree(300);
+    auto csr = tree.freeze();
+    auto result = csr.biconnectivity();
+
+    EXPECT_EQ(result.bridges.size(), 299);
+    EXPECT_EQ(result.block_count, 299);
+    EXPECT_EQ(result.two_edge_components.count, 300);
+    for (uint32_t v : result.articulation_points) {
+        EXPECT_GT(csr.degree(v), 1);
+    }
+    expect_same_biconnectivity(result, csr.parallel_biconnectivity(4));
+}
+
+TEST(BridgesTest, MatchesBruteForceOnRandomGraphs) {
+    std::mt19937 rng(23);
+    for (int round = 0; round < 30; ++round) {
+        std::uniform_int_distribution<int> vertex(0, 29);
+        std::vector<EdgeTuple> edges;
+        for (int i = 0; i < 35; ++i) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a != b) {
+                edges.emplace_back(a, b, 1);
+            }
+        }
+        auto csr = CsrGraph<int, int>::from_edge_list(edges);
+        auto result = csr.biconnectivity();
+        const size_t base = count_components(csr, {0, 0}, csr.vertex_count());
+        constexpr uint32_t no_vertex = std::numeric_limits<uint32_t>::max();
+
+        std::vector<std::pair<uint32_t, uint32_t>> bridges;
+        for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+            for (uint32_t w : csr.neighbors(v)) {
+                if (v < w && count_components(csr, {v, w}, no_vertex) > base) {
+                    bridges.emplace_back(v, w);
+                }
+            }
+        }
+        EXPECT_EQ(result.bridges, bridges);
+
+        std::vector<uint32_t> articulation_points;
+        for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+            if (count_components(csr, {0, 0}, v) > base) {
+                articulation_points.push_back(v);
+            }
+        }
+        EXPECT_EQ(result.articulation_points, articulation_points);
+
+        for (size_t threads : {1, 2, 4}) {
+            expect_same_biconnectivity(result, csr.parallel_biconnectivity(threads));
+        }
+    }
+}
+
+TEST(BridgesTest, LargeSparseGraphParallelAgrees) {
+    std::mt19937 rng(230);
+    std::uniform_int_distribution<int> vertex(0, 19999);
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 24000; ++i) {
+        int a = vertex(rng);
+        int b = vertex(rng);
+        if (a != b) {
+            edges.emplace_back(a, b, 1);
+        }
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto result = csr.biconnectivity();
+    EXPECT_FALSE(result.bridges.empty());
+    for (size_t threads : {2, 4}) {
+        expect_same_biconnectivity(result, csr.parallel_biconnectivity(threads));
+    }
+}
+
+TEST(BridgesTest, DeepPathDoesNotRecurse) {
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i + 1 < 200000; ++i) {
+        edges.emplace_back(i, i + 1, 1);
+    }
+    edges.emplace_back(199999, 199000, 1);
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+
+    auto result = csr.biconnectivity();
+    EXPECT_EQ(result.bridges.size(), 199000);
+    EXPECT_EQ(result.articulation_points.size(), 199000);
+    EXPECT_EQ(result.block_count, 199001);
+    expect_same_biconnectivity(result, csr.parallel_biconnectivity(4));
+}
+
+TEST(BridgesTest, EmptyGraphThrows) {
+    Graph<int, int, int> graph;
+    EXPECT_THROW(graph.find_biconnected_components(), std::runtime_error);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+TEST(GraphBuilderTest, CsrFromEdgeList) {
+    std::vector<EdgeTuple> edges = {
+        {10, 20, 1}, {20, 30, 2}, {30, 10, 3}, {20, 10, 9}, {40, 30, 4}
+    };
+
+    auto csr = CsrGraph<int, int>::from_edge_list(edges, 4);
+
+    EXPECT_EQ(csr.vertex_count(), 4);
+    EXPECT_EQ(csr.edge_count(), 4); // (20, 10) duplicates (10, 20)
+
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        auto neighbors = csr.neighbors(v);
+        EXPECT_TRUE(std::is_sorted(neighbors.begin(), neighbors.end()));
+    }
+
+    // The first occurrence of a duplicate keeps its weight
+    uint32_t a = csr.index_of(10);
+    uint32_t b = csr.index_of(20);
+    auto neighbors = csr.neighbors(a);
+    auto position = std::find(neighbors.begin(), neighbors.end(), b) - neighbors.begin();
+    EXPECT_EQ(csr.weights(a)[position], 1);
+
+    EXPECT_EQ(csr.degree(csr.index_of(30)), 3);
+}
+
+TEST(GraphBuilderTest, RejectsSelfLoops) {
+    std::vector<EdgeTuple> edges = {{1, 2, 1}, {3, 3, 1}};
+    EXPECT_THROW((CsrGraph<int, int>::from_edge_list(edges, 2)), std::invalid_argument);
+    EXPECT_THROW((Graph<int, int, int>::from_edge_list(edges)), std::invalid_argument);
+}
+
+TEST(GraphBuilderTest, GraphMatchesIncrementalBuild) {
+    std::vector<EdgeTuple> edges;
+    Graph<int, int, int> expected;
+    for (int i = 0; i < 200; ++i) {
+        expected.add_vertex(i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        for (int j = i + 1; j < std::min(i + 5, 200); ++j) {
+            edges.emplace_back(i, j, i + j);
+            expected.add_edge(i, j, i + j);
+        }
+    }
+    edges.emplace_back(1, 0, 100); // duplicate, ignored
+
+    auto graph = Graph<int, int, int>::from_edge_list(edges, 3);
+
+    EXPECT_EQ(graph.vertex_count(), expected.vertex_count());
+    EXPECT_EQ(graph.edge_count(), expected.edge_count());
+    for (const auto& [from, row] : expected.get_adjacency_list()) {
+        for (const auto& [to, edge] : row) {
+            ASSERT_TRUE(graph.has_edge(from, to));
+            EXPECT_EQ(graph.get_edge(from, to).get_weight(), edge->get_weight());
+        }
+    }
+
+    // The built graph is fully usable afterwards
+    graph.add_vertex(500);
+    graph.add_edge(500, 0, 1);
+    auto result = graph.shortest_paths_unweighted(500);
+    EXPECT_EQ(result.distances.at(199), 1 + (199 + 3) / 4);
+}
+
+TEST(GraphBuilderTest, EmptyEdgeList) {
+    std::vector<EdgeTuple> edges;
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    EXPECT_TRUE(csr.is_empty());
+    EXPECT_EQ(csr.edge_count(), 0);
+}
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
 #include "../include/graph.hpp"
 
 class GreedyColoringTest : public ::testing::Test {
@@ -54,3 +58,122 @@ TEST_F(GreedyColoringTest, InvalidStartVertexTest) {
     
     EXPECT_THROW(graph.greedy_coloring(1), std::runtime_error);
 }
+
+
+static bool is_proper_coloring(const CsrGraph<int, int>& csr, const std::vector<size_t>& colors) {
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        if (colors[v] == CsrGraph<int, int>::no_color || colors[v] > csr.degree(v)) {
+            return false;
+        }
+        for (uint32_t neighbor : csr.neighbors(v)) {
+            if (colors[neighbor] == colors[v]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static size_t color_count(const std::vector<size_t>& colors) {
+    return *std::max_element(colors.begin(), colors.end()) + 1;
+}
+
+class ColoringEngineTest : public ::testing::Test {
+protected:
+    CsrGraph<int, int> random_graph;
+
+    void SetUp() override {
+        std::mt19937 rng(19);
+        std::uniform_int_distribution<int> vertex(0, 1999);
+        std::vector<std::tuple<int, int, int>> edges;
+        for (int i = 0; i < 12000; ++i) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a != b) {
+                edges.emplace_back(a, b, 1);
+            }
+        }
+        random_graph = CsrGraph<int, int>::from_edge_list(edges);
+    }
+};
+
+TEST_F(ColoringEngineTest, OrderingsGiveProperColorings) {
+    for (auto order : {ColoringOrder::largest_first, ColoringOrder::smallest_last, ColoringOrder::saturation}) {
+        EXPECT_TRUE(is_proper_coloring(random_graph, random_graph.ordered_coloring(order)));
+    }
+    EXPECT_TRUE(is_proper_coloring(random_graph, random_graph.welsh_powell_coloring()));
+}
+
+TEST_F(ColoringEngineTest, ParallelColoringIsProperAndDeterministic) {
+    auto reference = random_graph.parallel_coloring(1, 7);
+    EXPECT_TRUE(is_proper_coloring(random_graph, reference));
+
+    // Priorities fix the coloring, so the thread count doesn't change it
+    for (size_t threads : {2, 3, 4}) {
+        EXPECT_EQ(random_graph.parallel_coloring(threads, 7), reference);
+    }
+    EXPECT_TRUE(is_proper_coloring(random_graph, random_graph.parallel_coloring(4, 8)));
+}
+
+TEST_F(ColoringEngineTest, OrderingsOnStructuredGraphs) {
+    // Trees are 1-degenerate, so smallest-last needs two colors; DSatur is exact on bipartite graphs
+    Graph<int, int, int> tree;
+    tree.generate_tree(500);
+    EXPECT_EQ(color_count(tree.freeze().ordered_coloring(ColoringOrder::smallest_last)), 2);
+
+    Graph<int, int, int> grid;
+    grid.generate_grid_graph(15, 20);
+    EXPECT_EQ(color_count(grid.freeze().ordered_coloring(ColoringOrder::saturation)), 2);
+
+    Graph<int, int, int> complete;
+    complete.generate_complete_graph(7);
+    auto csr = complete.freeze();
+    EXPECT_EQ(color_count(csr.welsh_powell_coloring()), 7);
+    EXPECT_EQ(color_count(csr.parallel_coloring()), 7);
+}
+
+TEST_F(ColoringEngineTest, PalettesSpanSeveralWords) {
+    // 130 colors are needed, so the free color sits past the first two palette words
+    Graph<int, int, int> complete;
+    complete.generate_complete_graph(130);
+    auto csr = complete.freeze();
+    EXPECT_EQ(color_count(csr.greedy_coloring(0)), 130);
+    EXPECT_EQ(color_count(csr.ordered_coloring(ColoringOrder::largest_first)), 130);
+    EXPECT_EQ(color_count(csr.parallel_coloring(4)), 130);
+
+    auto result = complete.greedy_coloring(0);
+    EXPECT_EQ(result.color_count, 130);
+}
+
+TEST(CountingSortTest, DescendingAndStable) {
+    std::vector<uint32_t> keys = {2, 0, 5, 2, 5, 1, 0, 3};
+    std::vector<uint32_t> vertices = {0, 1, 2, 3, 4, 5, 6, 7};
+    counting_sort_descending(vertices, 5, [&keys](uint32_t v) { return keys[v]; });
+    EXPECT_EQ(vertices, (std::vector<uint32_t>{2, 4, 7, 0, 3, 5, 1, 6}));
+}
+
+TEST_F(GreedyColoringTest, WelshPowellColoringTest) {
+    Graph<int, TestResource, double> graph;
+    EXPECT_THROW(graph.welsh_powell_coloring(), std::runtime_error);
+
+    for (int i = 0; i < 6; ++i) {
+        graph.add_vertex(i, TestResource(i));
+    }
+    // Star around 0 plus a triangle 3-4-5
+    for (int i = 1; i < 6; ++i) {
+        graph.add_edge(0, i, 1.0);
+    }
+    graph.add_edge(3, 4, 1.0);
+    graph.add_edge(4, 5, 1.0);
+    graph.add_edge(3, 5, 1.0);
+
+    auto result = graph.welsh_powell_coloring();
+    EXPECT_EQ(result.start, 0);
+    EXPECT_EQ(result.color_count, 4);
+    EXPECT_EQ(graph.get_vertex(0).get_color(), 0);
+    for (const auto& [vertex, edges] : graph.get_adjacency_list()) {
+        for (const auto& [neighbor, _] : edges) {
+            EXPECT_NE(result.colors.at(vertex), result.colors.at(neighbor));
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include "../include/contraction_hierarchy.hpp"
+
+class ContractionHierarchyTest : public ::testing::Test {
+protected:
+    static constexpr int side = 25;
+    Graph<int, int, int> graph;
+    const std::string filename = "contraction_hierarchy_test.bin";
+
+    void SetUp() override {
+        graph.generate_grid_graph(side, side);
+        std::mt19937 rng(17);
+        for (const auto& [from, row] : graph.get_adjacency_list()) {
+            for (const auto& [to, edge] : row) {
+                if (from < to) {
+                    graph.set_edge_weight(from, to, 1 + static_cast<int>(rng() % 20));
+                }
+            }
+        }
+        // A few long-range links and an island
+        graph.add_edge(0, side * side - 1, 90);
+        graph.add_edge(3, 400, 35);
+        graph.add_vertex(1000);
+        graph.add_vertex(1001);
+        graph.add_edge(1000, 1001, 4);
+    }
+
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+
+    void expect_matches_dijkstra(const ContractionHierarchy<int, int>& hierarchy) {
+        auto csr = graph.freeze();
+        typename ContractionHierarchy<int, int>::Query query(hierarchy);
+        std::mt19937 rng(8);
+
+        for (int round = 0; round < 10; ++round) {
+            int source = static_cast<int>(rng() % (side * side));
+            auto expected = csr.dijkstra(source);
+            for (int k = 0; k < 10; ++k) {
+                int target = static_cast<int>(rng() % (side * side));
+                int distance = expected.distances[csr.index_of(target)];
+                EXPECT_EQ(query.distance(source, target), distance);
+
+                auto path = query.shortest_path(source, target);
+                ASSERT_TRUE(path.found());
+                EXPECT_EQ(path.distance, distance);
+                EXPECT_EQ(path.path[0], source);
+                EXPECT_EQ(path.path[path.path.size() - 1], target);
+
+                int length = 0;
+                for (size_t i = 0; i + 1 < path.path.size(); ++i) {
+                    ASSERT_TRUE(graph.has_edge(path.path[i], path.path[i + 1]));
+                    length += graph.get_edge(path.path[i], path.path[i + 1]).get_weight();
+                }
+                EXPECT_EQ(length, distance);
+            }
+        }
+    }
+};
+
+TEST_F(ContractionHierarchyTest, QueriesMatchDijkstra) {
+    auto hierarchy = ContractionHierarchy<int, int>::build(graph);
+    EXPECT_EQ(hierarchy.vertex_count(), graph.vertex_count());
+    EXPECT_GE(hierarchy.upward_edge_count(), graph.edge_count());
+    expect_matches_dijkstra(hierarchy);
+}
+
+TEST_F(ContractionHierarchyTest, RanksArePermutation) {
+    auto hierarchy = ContractionHierarchy<int, int>::build(graph);
+    std::vector<bool> seen(hierarchy.vertex_count(), false);
+    for (const auto& [id, _] : graph.get_vertices()) {
+        uint32_t rank = hierarchy.rank_of(id);
+        ASSERT_LT(rank, seen.size());
+        EXPECT_FALSE(seen[rank]);
+        seen[rank] = true;
+    }
+}
+
+TEST_F(ContractionHierarchyTest, UnreachableAndSameVertex) {
+    auto hierarchy = ContractionHierarchy<int, int>::build(graph);
+    EXPECT_EQ(hierarchy.distance(0, 1000), std::numeric_limits<int>::max());
+    EXPECT_FALSE(hierarchy.shortest_path(0, 1001).found());
+    EXPECT_EQ(hierarchy.distance(1000, 1001), 4);
+
+    auto same = hierarchy.shortest_path(5, 5);
+    ASSERT_TRUE(same.found());
+    EXPECT_EQ(same.distance, 0);
+    EXPECT_EQ(same.path.size(), 1);
+
+    EXPECT_THROW(hierarchy.distance(0, 5000), std::runtime_error);
+}
+
+TEST_F(ContractionHierarchyTest, SaveAndLoad) {
+    auto hierarchy = ContractionHierarchy<int, int>::build(graph);
+    hierarchy.save(filename);
+
+    auto loaded = ContractionHierarchy<int, int>::load(filename);
+    EXPECT_EQ(loaded.vertex_count(), hierarchy.vertex_count());
+    EXPECT_EQ(loaded.shortcut_count(), hierarchy.shortcut_count());
+    expect_matches_dijkstra(loaded);
+
+    EXPECT_THROW((ContractionHierarchy<int, double>::load(filename)), std::runtime_error);
+    EXPECT_THROW((ContractionHierarchy<int, int>::load("missing_hierarchy.bin")), std::runtime_error);
+}
+
+TEST_F(ContractionHierarchyTest, LoadRejectsCraftedFiles) {
+    ContractionHierarchy<int, int>::build(graph).save(filename);
+    std::string original;
+    {
+        std::ifstream file(filename, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        original = buffer.str();
+    }
+    auto load_patched = [&](size_t position, const void* value, size_t bytes) {
+        std::string patched = original;
+        std::memcpy(patched.data() + position, value, bytes);
+        {
+            std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+            file.write(patched.data(), static_cast<std::streamsize>(patched.size()));
+        }
+        return ContractionHierarchy<int, int>::load(filename);
+    };
+
+    // Counts follow the 8 byte magic and four 32 bit header fields
+    const size_t counts_position = 24;
+    const uint64_t huge = uint64_t(1) << 61;
+    EXPECT_THROW(load_patched(counts_position, &huge, sizeof(huge)), std::runtime_error);
+    EXPECT_THROW(load_patched(counts_position + sizeof(uint64_t), &huge, sizeof(huge)), std::runtime_error);
+
+    // First upward target, right after the ids, ranks and offsets
+    const size_t n = side * side;
+    const size_t targets_position = counts_position + 3 * sizeof(uint64_t) + n * (sizeof(int) + sizeof(uint32_t)) +
+                                    (n + 1) * sizeof(size_t);
+    const uint32_t outside = n;
+    EXPECT_THROW(load_patched(targets_position, &outside, sizeof(outside)), std::runtime_error);
+
+    EXPECT_NO_THROW(load_patched(0, original.data(), 0));
+}
+
+TEST_F(ContractionHierarchyTest, NegativeWeight) {
+    graph.set_edge_weight(0, 1, -1);
+    EXPECT_THROW((ContractionHierarchy<int, int>::build(graph)), std::runtime_error);
+}
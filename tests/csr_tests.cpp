@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "../include/graph.hpp"
+
+class CsrGraphTest : public ::testing::Test {
+protected:
+    Graph<int, int, int> graph;
+
+    void SetUp() override {
+        // 0 - 1 - 2 - 3 plus a shortcut 0 - 2 and an isolated pair 4 - 5
+        for (int i = 0; i < 6; ++i) {
+            graph.add_vertex(i, i);
+        }
+        graph.add_edge(0, 1, 1);
+        graph.add_edge(1, 2, 2);
+        graph.add_edge(2, 3, 1);
+        graph.add_edge(0, 2, 5);
+        graph.add_edge(4, 5, 7);
+    }
+};
+
+TEST_F(CsrGraphTest, FreezePreservesStructure) {
+    auto csr = graph.freeze();
+
+    EXPECT_EQ(csr.vertex_count(), graph.vertex_count());
+    EXPECT_EQ(csr.edge_count(), graph.edge_count());
+
+    for (int i = 0; i < 6; ++i) {
+        uint32_t index = csr.index_of(i);
+        EXPECT_EQ(csr.id_of(index), i);
+        EXPECT_EQ(csr.degree(index), graph.get_degree(i));
+
+        auto neighbors = csr.neighbors(index);
+        auto weights = csr.weights(index);
+        for (size_t k = 0; k < neighbors.size(); ++k) {
+            int neighbor = csr.id_of(neighbors[k]);
+            EXPECT_TRUE(graph.has_edge(i, neighbor));
+            EXPECT_EQ(weights[k], graph.get_edge(i, neighbor).get_weight());
+        }
+    }
+}
+
+TEST_F(CsrGraphTest, EmptyAndMissingVertex) {
+    Graph<int, int, int> empty_graph;
+    auto empty = empty_graph.freeze();
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_THROW(empty.breadth_first_search(0), std::runtime_error);
+
+    auto csr = graph.freeze();
+    EXPECT_THROW(csr.breadth_first_search(42), std::runtime_error);
+    EXPECT_THROW(csr.dijkstra(42), std::runtime_error);
+    EXPECT_THROW(csr.index_of(42), std::invalid_argument);
+}
+
+TEST_F(CsrGraphTest, BreadthFirstSearch) {
+    auto csr = graph.freeze();
+    auto result = csr.breadth_first_search(0);
+
+    EXPECT_EQ(result.order.size(), 4);
+    EXPECT_EQ(result.order.front(), csr.index_of(0));
+    EXPECT_EQ(result.discovery_time[csr.index_of(0)], 0);
+    EXPECT_EQ(result.discovery_time[csr.index_of(4)], -1);
+
+    // Vertex 3 is two hops away, so it is discovered after both direct neighbors of 0
+    EXPECT_GT(result.discovery_time[csr.index_of(3)], result.discovery_time[csr.index_of(1)]);
+    EXPECT_GT(result.discovery_time[csr.index_of(3)], result.discovery_time[csr.index_of(2)]);
+}
+
+TEST_F(CsrGraphTest, DepthFirstSearch) {
+    auto csr = graph.freeze();
+    auto result = csr.depth_first_search(3);
+
+    EXPECT_EQ(result.order.size(), 4);
+    EXPECT_EQ(result.discovery_time[csr.index_of(3)], 0);
+    EXPECT_EQ(result.finish_time[csr.index_of(3)], 7);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_LT(result.discovery_time[csr.index_of(i)], result.finish_time[csr.index_of(i)]);
+    }
+}
+
+TEST_F(CsrGraphTest, ConnectedComponents) {
+    auto csr = graph.freeze();
+    auto result = csr.find_connected_components();
+
+    EXPECT_EQ(result.count, 2);
+    EXPECT_EQ(result.labels[csr.index_of(0)], result.labels[csr.index_of(3)]);
+    EXPECT_EQ(result.labels[csr.index_of(4)], result.labels[csr.index_of(5)]);
+    EXPECT_NE(result.labels[csr.index_of(0)], result.labels[csr.index_of(4)]);
+}
+
+TEST_F(CsrGraphTest, Dijkstra) {
+    auto csr = graph.freeze();
+    auto result = csr.dijkstra(0);
+
+    EXPECT_EQ(result.distances[csr.index_of(0)], 0);
+    EXPECT_EQ(result.distances[csr.index_of(1)], 1);
+    EXPECT_EQ(result.distances[csr.index_of(2)], 3);
+    EXPECT_EQ(result.distances[csr.index_of(3)], 4);
+    EXPECT_EQ(result.distances[csr.index_of(4)], std::numeric_limits<int>::max());
+    EXPECT_EQ(result.previous[csr.index_of(2)], csr.index_of(1));
+}
+
+TEST_F(CsrGraphTest, DijkstraNegativeWeight) {
+    graph.set_edge_weight(4, 5, -1);
+    auto csr = graph.freeze();
+    EXPECT_THROW(csr.dijkstra(0), std::runtime_error);
+}
+
+TEST_F(CsrGraphTest, GreedyColoringIsProper) {
+    Graph<int, int, int> complete;
+    complete.generate_complete_graph(5);
+    auto csr = complete.freeze();
+    auto colors = csr.greedy_coloring(0);
+
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        EXPECT_LT(colors[v], 5);
+        for (uint32_t u : csr.neighbors(v)) {
+            EXPECT_NE(colors[u], colors[v]);
+        }
+    }
+    EXPECT_EQ(colors[csr.index_of(0)], 0);
+}
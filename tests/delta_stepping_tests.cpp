@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+template <typename WeightType>
+static void expect_matches_dijkstra(const CsrGraph<int, WeightType>& csr, int start,
+                                    std::optional<WeightType> delta, size_t threads) {
+    auto expected = csr.dijkstra(start);
+    auto result = csr.delta_stepping(start, delta, threads);
+
+    ASSERT_EQ(result.distances.size(), expected.distances.size());
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        EXPECT_EQ(result.distances[v], expected.distances[v]);
+        if (result.distances[v] == std::numeric_limits<WeightType>::max() || csr.id_of(v) == start) {
+            EXPECT_EQ(result.previous[v], v);
+            continue;
+        }
+        // The predecessor must lie on a shortest path
+        uint32_t parent = result.previous[v];
+        auto neighbors = csr.neighbors(parent);
+        auto weights = csr.weights(parent);
+        auto it = std::lower_bound(neighbors.begin(), neighbors.end(), v);
+        ASSERT_NE(it, neighbors.end());
+        EXPECT_EQ(result.distances[parent] + weights[it - neighbors.begin()], result.distances[v]);
+    }
+}
+
+TEST(DeltaSteppingTest, RandomIntegerWeights) {
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> vertex(0, 2999);
+    std::uniform_int_distribution<int> weight(0, 100);
+    std::vector<std::tuple<int, int, int>> edges;
+    for (int i = 0; i < 12000; ++i) {
+        int a = vertex(rng);
+        int b = vertex(rng);
+        if (a != b) {
+            edges.emplace_back(a, b, weight(rng));
+        }
+    }
+    edges.emplace_back(7000, 7001, 3); // unreachable pair
+
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    int start = std::get<0>(edges.front());
+
+    for (std::optional<int> delta : {std::optional<int>(), std::optional<int>(1), std::optional<int>(10),
+                                     std::optional<int>(1000)}) {
+        for (size_t threads : {1, 4}) {
+            expect_matches_dijkstra(csr, start, delta, threads);
+        }
+    }
+}
+
+TEST(DeltaSteppingTest, FloatingPointGrid) {
+    Graph<int, int, double> graph;
+    graph.generate_grid_graph(30, 30);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> weight(0.0, 2.0);
+    for (const auto& [from, row] : graph.get_adjacency_list()) {
+        for (const auto& [to, edge] : row) {
+            if (from < to) {
+                graph.set_edge_weight(from, to, weight(rng));
+            }
+        }
+    }
+    auto csr = graph.freeze();
+
+    expect_matches_dijkstra<double>(csr, 0, std::nullopt, 2);
+    expect_matches_dijkstra<double>(csr, 0, 0.3, 3);
+}
+
+TEST(DeltaSteppingTest, RejectsInvalidInput) {
+    auto csr = CsrGraph<int, int>::from_edge_list(std::vector<std::tuple<int, int, int>>{{1, 2, -1}});
+    EXPECT_THROW(csr.delta_stepping(1), std::runtime_error);
+
+    auto valid = CsrGraph<int, int>::from_edge_list(std::vector<std::tuple<int, int, int>>{{1, 2, 1}});
+    EXPECT_THROW(valid.delta_stepping(1, -5), std::invalid_argument);
+    EXPECT_THROW(valid.delta_stepping(1, 0), std::invalid_argument);
+
+    auto unsigned_weights =
+        CsrGraph<int, unsigned>::from_edge_list(std::vector<std::tuple<int, int, unsigned>>{{1, 2, 1u}});
+    EXPECT_THROW(unsigned_weights.delta_stepping(1, 0u), std::invalid_argument);
+    EXPECT_THROW(valid.delta_stepping(3), std::runtime_error);
+}
+
+TEST(DeltaSteppingTest, NarrowBucketsOverWideWeights) {
+    // A dense ring would need about 1e9 buckets here
+    std::vector<std::tuple<int, int, int>> edges = {
+        {0, 1, 1000000000}, {1, 2, 1}, {0, 2, 999999999}, {2, 3, 500000000}, {3, 4, 2}};
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    for (size_t threads : {1, 2}) {
+        expect_matches_dijkstra<int>(csr, 0, 1, threads);
+    }
+}
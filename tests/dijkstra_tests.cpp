@@ -34,16 +34,11 @@ TEST_F(DijkstraTest, SimplePathTest) {
     graph.add_edge(0, 1, 1);
     graph.add_edge(1, 2, 2);
 
-    EXPECT_NO_THROW(graph.dijkstra(0));
-    
-    // Verify distances through the results file
-    std::ifstream file("files/dijkstra_results.json");
-    json results;
-    file >> results;
+    auto results = graph.dijkstra(0);
     
-    EXPECT_EQ(results["distances"]["0"], 0);
-    EXPECT_EQ(results["distances"]["1"], 1);
-    EXPECT_EQ(results["distances"]["2"], 3);
+    EXPECT_EQ(results.distances.at(0), 0);
+    EXPECT_EQ(results.distances.at(1), 1);
+    EXPECT_EQ(results.distances.at(2), 3);
 }
 
 // Complex graph tests
@@ -61,17 +56,13 @@ TEST_F(DijkstraTest, ComplexGraphTest) {
     graph.add_edge(2, 4, 10);
     graph.add_edge(3, 4, 2);
     
-    EXPECT_NO_THROW(graph.dijkstra(0));
-    
-    std::ifstream file("files/dijkstra_results.json");
-    json results;
-    file >> results;
+    auto results = graph.dijkstra(0);
     
-    EXPECT_EQ(results["distances"]["0"], 0);
-    EXPECT_EQ(results["distances"]["1"], 4);
-    EXPECT_EQ(results["distances"]["2"], 2);
-    EXPECT_EQ(results["distances"]["3"], 9);
-    EXPECT_EQ(results["distances"]["4"], 11);
+    EXPECT_EQ(results.distances.at(0), 0);
+    EXPECT_EQ(results.distances.at(1), 4);
+    EXPECT_EQ(results.distances.at(2), 2);
+    EXPECT_EQ(results.distances.at(3), 9);
+    EXPECT_EQ(results.distances.at(4), 11);
 }
 
 
@@ -85,15 +76,30 @@ TEST_F(DijkstraTest, CycleTest) {
     graph.add_edge(1, 2, 2);
     graph.add_edge(2, 0, 4);
     
-    EXPECT_NO_THROW(graph.dijkstra(0));
+    auto results = graph.dijkstra(0);
     
+    EXPECT_EQ(results.distances.at(0), 0);
+    EXPECT_EQ(results.distances.at(1), 1);
+    EXPECT_EQ(results.distances.at(2), 4);
+}
+
+TEST_F(DijkstraTest, ExportWritesResultsFile) {
+    for(int i = 0; i < 3; i++) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(0, 1, 2);
+
+    auto results = graph.dijkstra(0);
+    EXPECT_FALSE(results.reached(2));
+    graph.export_dijkstra(results);
+
     std::ifstream file("files/dijkstra_results.json");
-    json results;
-    file >> results;
-    
-    EXPECT_EQ(results["distances"]["0"], 0);
-    EXPECT_EQ(results["distances"]["1"], 1);
-    EXPECT_EQ(results["distances"]["2"], 4);
+    json data;
+    file >> data;
+
+    EXPECT_EQ(data["distances"]["1"], 2);
+    EXPECT_EQ(data["paths"]["1"].size(), 2);
+    EXPECT_EQ(data["paths"]["2"].size(), 0);
 }
 
 // Large graph performance test
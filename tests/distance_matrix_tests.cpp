@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+class DistanceMatrixTest : public ::testing::Test {
+protected:
+    CsrGraph<int, int> csr;
+    std::vector<int> sources;
+
+    void SetUp() override {
+        std::mt19937 rng(13);
+        std::uniform_int_distribution<int> vertex(0, 799);
+        std::vector<std::tuple<int, int, int>> edges;
+        for (int i = 0; i < 2400; ++i) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a != b) {
+                edges.emplace_back(a, b, 1 + static_cast<int>(rng() % 30));
+            }
+        }
+        edges.emplace_back(900, 901, 1); // unreachable from the rest
+        csr = CsrGraph<int, int>::from_edge_list(edges);
+
+        // More than one 64-source batch, with a repeated source
+        for (int i = 0; i < 150; ++i) {
+            sources.push_back(csr.id_of(static_cast<uint32_t>((i * 37) % csr.vertex_count())));
+        }
+        sources.push_back(sources.front());
+    }
+};
+
+TEST_F(DistanceMatrixTest, WeightedRowsMatchDijkstra) {
+    for (size_t threads : {1, 3}) {
+        auto matrix = csr.distance_matrix(sources, threads);
+        ASSERT_EQ(matrix.sources.size(), sources.size());
+        for (size_t row = 0; row < sources.size(); ++row) {
+            auto expected = csr.dijkstra(sources[row]);
+            auto actual = matrix.row(row);
+            EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.distances.begin(), expected.distances.end()));
+        }
+    }
+}
+
+TEST_F(DistanceMatrixTest, BitParallelBfsMatchesBfsLevels) {
+    for (size_t threads : {1, 2}) {
+        auto matrix = csr.unweighted_distance_matrix(sources, threads);
+        for (size_t row = 0; row < sources.size(); ++row) {
+            auto tree = csr.parallel_breadth_first_search(sources[row], 1);
+            for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+                uint32_t expected = tree.levels[v] == -1 ? std::numeric_limits<uint32_t>::max()
+                                                         : static_cast<uint32_t>(tree.levels[v]);
+                ASSERT_EQ(matrix.at(row, v), expected) << "row " << row << " vertex " << v;
+            }
+        }
+    }
+}
+
+TEST_F(DistanceMatrixTest, InvalidInput) {
+    std::vector<int> missing = {sources.front(), 5000};
+    EXPECT_THROW(csr.distance_matrix(missing), std::runtime_error);
+    EXPECT_THROW(csr.unweighted_distance_matrix(missing), std::runtime_error);
+
+    std::vector<int> none;
+    EXPECT_TRUE(csr.distance_matrix(none).distances.empty());
+    EXPECT_TRUE(csr.unweighted_distance_matrix(none).distances.empty());
+}
+
+TEST(GraphDistanceMatrixTest, RowsMatchPerSourceQueries) {
+    Graph<int, int, int> graph;
+    graph.generate_grid_graph(12, 12);
+    std::mt19937 rng(3);
+    for (const auto& [from, row] : graph.get_adjacency_list()) {
+        for (const auto& [to, edge] : row) {
+            if (from < to) {
+                graph.set_edge_weight(from, to, 1 + static_cast<int>(rng() % 9));
+            }
+        }
+    }
+    graph.add_vertex(500);
+    graph.remove_vertex(7); // slots no longer follow the ids
+
+    std::vector<int> sources = {0, 143, 500, 66};
+    auto weighted = graph.distance_matrix(sources, 2);
+    auto unweighted = graph.unweighted_distance_matrix(sources, 2);
+    ASSERT_EQ(weighted.sources.size(), sources.size());
+    for (size_t row = 0; row < sources.size(); ++row) {
+        EXPECT_EQ(weighted.sources[row], sources[row]);
+        auto expected = graph.freeze().dijkstra(sources[row]);
+        auto distances = weighted.distances(row);
+        auto hops = unweighted.distances(row);
+        auto expected_hops = graph.shortest_paths_unweighted(sources[row]);
+        EXPECT_EQ(hops.size(), expected_hops.distances.size());
+        for (const auto& [id, hop_count] : expected_hops.distances) {
+            EXPECT_EQ(hops.at(id), hop_count);
+            EXPECT_EQ(distances.at(id), expected.distances[graph.get_slot(id)]);
+        }
+        EXPECT_EQ(distances.size(), expected_hops.distances.size());
+    }
+
+    std::vector<int> missing = {7};
+    EXPECT_THROW(graph.distance_matrix(missing), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "../include/graph.hpp"
+
+TEST(DynamicConnectivityTest, CycleSurvivesOneDeletion) {
+    DynamicConnectivity<int> index;
+    for (int i = 0; i < 4; ++i) {
+        index.add_vertex(i);
+    }
+    index.add_edge(0, 1);
+    index.add_edge(1, 2);
+    index.add_edge(2, 3);
+    index.add_edge(3, 0);
+    EXPECT_EQ(index.component_count(), 1);
+
+    index.remove_edge(1, 2);
+    EXPECT_TRUE(index.connected(1, 2));
+    EXPECT_EQ(index.component_size(2), 4);
+
+    index.remove_edge(3, 0);
+    EXPECT_FALSE(index.connected(0, 3));
+    EXPECT_EQ(index.component_count(), 2);
+    EXPECT_EQ(index.component_size(0), 2);
+
+    EXPECT_THROW(index.remove_edge(0, 2), std::invalid_argument);
+    EXPECT_THROW(index.add_edge(0, 1), std::invalid_argument);
+    EXPECT_THROW(index.remove_vertex(0), std::invalid_argument);
+}
+
+TEST(DynamicConnectivityTest, RandomUpdatesMatchRecomputation) {
+    std::mt19937 rng(18);
+    const int n = 120;
+    Graph<int, int, int> graph;
+    graph.enable_dynamic_connectivity();
+    for (int i = 0; i < n; ++i) {
+        graph.add_vertex(i, i);
+    }
+
+    std::vector<std::pair<int, int>> edges;
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    for (int step = 0; step < 4000; ++step) {
+        // Bias towards insertions early so the graph goes through dense and sparse phases
+        bool insert = edges.empty() || rng() % 100 < (step < 2000 ? 65u : 45u);
+        if (insert) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a == b || graph.has_edge(a, b)) {
+                continue;
+            }
+            graph.add_edge(a, b, 1);
+            edges.emplace_back(a, b);
+        } else {
+            size_t k = rng() % edges.size();
+            graph.remove_edge(edges[k].first, edges[k].second);
+            edges[k] = edges.back();
+            edges.pop_back();
+        }
+
+        if (step % 50 == 0) {
+            auto components = graph.find_connected_components();
+            ASSERT_EQ(graph.component_count(), components.size()) << "step " << step;
+            for (const auto& component : components) {
+                for (const auto& id : component) {
+                    ASSERT_TRUE(graph.same_component(component[0], id));
+                }
+                ASSERT_EQ(graph.component_size(component[0]), component.size());
+            }
+            int a = vertex(rng);
+            int b = vertex(rng);
+            Graph<int, int, int>::Workspace workspace;
+            bool reachable = graph.breadth_first_search(a, workspace).reached(b);
+            ASSERT_EQ(graph.same_component(a, b), reachable);
+        }
+    }
+}
+
+TEST(DynamicConnectivityTest, FollowsVertexRemovalAndBulkChanges) {
+    Graph<int, int, int> graph;
+    graph.generate_path_graph(6);
+    graph.enable_dynamic_connectivity();
+    EXPECT_EQ(graph.component_count(), 1);
+
+    graph.remove_vertex(2);
+    EXPECT_EQ(graph.component_count(), 2);
+    EXPECT_FALSE(graph.same_component(0, 5));
+    EXPECT_TRUE(graph.same_component(3, 5));
+
+    graph.generate_cycle_graph(5);
+    EXPECT_TRUE(graph.has_dynamic_connectivity());
+    EXPECT_EQ(graph.component_count(), 1);
+    graph.remove_edge(0, 1);
+    EXPECT_TRUE(graph.same_component(0, 1));
+
+    graph.disable_dynamic_connectivity();
+    EXPECT_EQ(graph.component_count(), 1);
+}
+
+TEST(DynamicConnectivityTest, CopiesOwnTheirIndex) {
+    Graph<int, int, int> graph;
+    for (int i = 0; i < 3; ++i) {
+        graph.add_vertex(i, i);
+    }
+    graph.enable_dynamic_connectivity();
+    graph.add_edge(0, 1, 1);
+    graph.add_edge(1, 2, 1);
+
+    Graph<int, int, int> copy = graph;
+    copy.remove_edge(1, 2);
+    EXPECT_FALSE(copy.same_component(0, 2));
+    EXPECT_TRUE(graph.same_component(0, 2));
+}
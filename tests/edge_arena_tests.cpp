@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <type_traits>
+#include "../include/graph.hpp"
+
+TEST(EdgeArenaTest, CreateAndReuse) {
+    EdgeArena<int, int> arena;
+    auto* a = arena.create(0, 1, 5);
+    auto* b = arena.create(1, 2, 7);
+
+    EXPECT_EQ(arena.size(), 2);
+    EXPECT_EQ(a->get_weight(), 5);
+    EXPECT_EQ(b->get_to(), 2);
+
+    // Released slots are handed out again before the arena grows
+    arena.release(a);
+    auto* c = arena.create(3, 4, 1);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(c->get_from(), 3);
+    EXPECT_EQ(arena.size(), 2);
+}
+
+TEST(EdgeArenaTest, ReserveUsesSingleChunk) {
+    EdgeArena<int, double> arena;
+    arena.reserve(100000);
+
+    for (int i = 0; i < 100000; ++i) {
+        arena.create(i, i + 1, 1.0);
+    }
+    EXPECT_EQ(arena.chunk_count(), 1);
+    EXPECT_EQ(arena.size(), 100000);
+}
+
+TEST(EdgeArenaTest, HandlesStayValidWhileGrowing) {
+    EdgeArena<int, int> arena;
+    auto* first = arena.create(0, 1, 42);
+
+    for (int i = 0; i < 10000; ++i) {
+        arena.create(i, i + 1, i);
+    }
+    EXPECT_GT(arena.chunk_count(), 1);
+    EXPECT_EQ(first->get_weight(), 42);
+}
+
+TEST(EdgeArenaTest, GraphSharesOneEdgeForBothDirections) {
+    Graph<int, int, int> graph;
+    graph.generate_grid_graph(20, 20);
+
+    EXPECT_EQ(&graph.get_edge(0, 1), &graph.get_edge(1, 0));
+
+    graph.set_edge_weight(0, 1, 9);
+    EXPECT_EQ(graph.get_edge(1, 0).get_weight(), 9);
+
+    graph.remove_vertex(0);
+    graph.add_vertex(0);
+    graph.add_edge(0, 1, 3);
+    EXPECT_EQ(graph.get_edge(1, 0).get_weight(), 3);
+    EXPECT_EQ(graph.edge_count(), 2 * 20 * 19 - 1);
+}
+
+TEST(EdgeArenaTest, PublicHandlesAreReadOnly) {
+    // Writing a weight through the adjacency list would bypass the arena's weight counters
+    using Handle = Graph<int, int, int>::EdgeHandle;
+    static_assert(std::is_const_v<std::remove_pointer_t<Handle>>);
+
+    Graph<int, int, int> graph;
+    graph.generate_path_graph(3);
+    const Handle handle = graph.get_adjacency_list().at(0).at(1);
+    graph.set_edge_weight(0, 1, -4);
+    EXPECT_EQ(handle->get_weight(), -4);
+    EXPECT_THROW(graph.dijkstra(2), std::runtime_error);
+}
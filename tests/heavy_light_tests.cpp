@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+// Random tree on 0..n-1 with vertex i hanging under a random earlier vertex
+static std::vector<EdgeTuple> random_tree(int n, std::mt19937& rng) {
+    std::vector<EdgeTuple> edges;
+    for (int i = 1; i < n; ++i) {
+        std::uniform_int_distribution<int> parent(0, i - 1);
+        std::uniform_int_distribution<int> weight(-50, 100);
+        edges.emplace_back(parent(rng), i, weight(rng));
+    }
+    return edges;
+}
+
+// Path sum and max by walking parents, for checking
+static std::pair<int, int> naive_path(const LcaIndex<int>& index, const std::map<std::pair<int, int>, int>& weights,
+                                      int u, int v) {
+    int sum = 0;
+    int max = std::numeric_limits<int>::lowest();
+    auto climb = [&](int& vertex) {
+        int parent = index.parent(vertex);
+        int weight = weights.at({std::min(vertex, parent), std::max(vertex, parent)});
+        sum += weight;
+        max = std::max(max, weight);
+        vertex = parent;
+    };
+    while (index.depth(u) > index.depth(v)) climb(u);
+    while (index.depth(v) > index.depth(u)) climb(v);
+    while (u != v) {
+        climb(u);
+        climb(v);
+    }
+    return {sum, max};
+}
+
+TEST(HeavyLightTest, SmallTreePathsAndUpdates) {
+    // Children: 0 -> {1, 2}, 1 -> {3, 4}, 2 -> {5}, 4 -> {6}
+    std::vector<EdgeTuple> edges = {{0, 1, 3}, {0, 2, 5}, {1, 3, 2}, {1, 4, 7}, {2, 5, 1}, {4, 6, 4}};
+    auto hld = HeavyLightDecomposition<int, int>::build(CsrGraph<int, int>::from_edge_list(edges));
+
+    EXPECT_EQ(hld.path_sum(6, 5), 4 + 7 + 3 + 5 + 1);
+    EXPECT_EQ(hld.path_max(6, 5), 7);
+    EXPECT_EQ(hld.path_sum(3, 4), 9);
+    EXPECT_EQ(hld.path_max(6, 4), 4);
+    EXPECT_EQ(hld.path_sum(2, 2), 0);
+    EXPECT_EQ(hld.path_max(2, 2), std::numeric_limits<int>::lowest());
+    EXPECT_EQ(hld.head(6), 0); // 0 -> 1 -> 4 -> 6 is the heavy chain
+    EXPECT_EQ(hld.head(5), 2);
+
+    hld.set_edge_weight(4, 1, 10);
+    EXPECT_EQ(hld.edge_weight(1, 4), 10);
+    EXPECT_EQ(hld.path_max(6, 5), 10);
+    EXPECT_EQ(hld.path_sum(6, 5), 4 + 10 + 3 + 5 + 1);
+
+    EXPECT_THROW(hld.set_edge_weight(3, 4, 1), std::invalid_argument);
+    EXPECT_THROW(hld.path_sum(0, 42), std::invalid_argument);
+}
+
+TEST(HeavyLightTest, RandomTreeMatchesNaive) {
+    std::mt19937 rng(25);
+    const int n = 3000;
+    auto edges = random_tree(n, rng);
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto hld = HeavyLightDecomposition<int, int>::build(csr);
+    auto index = LcaIndex<int>::build(csr);
+
+    std::map<std::pair<int, int>, int> weights;
+    for (const auto& [u, v, weight] : edges) {
+        weights[{u, v}] = weight;
+    }
+
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(-50, 100);
+    for (int round = 0; round < 2000; ++round) {
+        if (round % 4 == 0) {
+            auto [u, v, old_weight] = edges[vertex(rng) % edges.size()];
+            int new_weight = weight(rng);
+            hld.set_edge_weight(v, u, new_weight);
+            weights[{u, v}] = new_weight;
+        }
+        int u = vertex(rng);
+        int v = vertex(rng);
+        if (u == v) {
+            continue;
+        }
+        auto [sum, max] = naive_path(index, weights, u, v);
+        EXPECT_EQ(hld.path_sum(u, v), sum);
+        EXPECT_EQ(hld.path_max(u, v), max);
+    }
+}
+
+TEST(HeavyLightTest, DeepPathIsIterative) {
+    const int n = 200000;
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i + 1 < n; ++i) {
+        edges.emplace_back(i, i + 1, i % 7);
+    }
+    auto hld = HeavyLightDecomposition<int, int>::build(CsrGraph<int, int>::from_edge_list(edges), n / 2);
+
+    long long expected = 0;
+    for (int i = 0; i + 1 < n; ++i) {
+        expected += i % 7;
+    }
+    EXPECT_EQ(hld.path_sum(0, n - 1), expected);
+    EXPECT_EQ(hld.path_max(0, n - 1), 6);
+    EXPECT_EQ(hld.depth(0), n / 2);
+}
+
+TEST(HeavyLightTest, BottleneckOnSpanningForest) {
+    // The minimum spanning forest of a graph with two components
+    std::vector<EdgeTuple> edges = {{0, 1, 4}, {1, 2, 1}, {0, 2, 2}, {2, 3, 7}, {10, 11, 1}, {11, 12, 3}};
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto forest = csr.kruskal();
+
+    std::vector<EdgeTuple> tree_edges;
+    for (const auto& [u, v, weight] : forest.edges) {
+        tree_edges.emplace_back(csr.id_of(u), csr.id_of(v), weight);
+    }
+    auto hld = HeavyLightDecomposition<int, int>::build(CsrGraph<int, int>::from_edge_list(tree_edges));
+
+    // 0 - 1 skips its weight 4 edge in favour of 0 - 2 - 1
+    EXPECT_EQ(hld.path_max(0, 1), 2);
+    EXPECT_EQ(hld.path_max(1, 3), 7);
+    EXPECT_EQ(hld.path_sum(10, 12), 4);
+    EXPECT_EQ(hld.path_sum(0, 12), std::nullopt);
+    EXPECT_EQ(hld.path_max(3, 11), std::nullopt);
+
+    using Decomposition = HeavyLightDecomposition<int, int>;
+    EXPECT_THROW(Decomposition::build(csr), std::runtime_error);
+}
+
+TEST(HeavyLightTest, GraphWrapper) {
+    Graph<int, int, int> tree;
+    tree.add_vertex(1);
+    tree.add_vertex(2);
+    tree.add_vertex(3);
+    tree.add_edge(1, 2, 5);
+    tree.add_edge(2, 3, 9);
+
+    auto hld = tree.heavy_light_decomposition(3);
+    EXPECT_EQ(hld.depth(1), 2);
+    EXPECT_EQ(hld.path_sum(1, 3), 14);
+    EXPECT_EQ(hld.path_max(1, 3), 9);
+    EXPECT_THROW(tree.heavy_light_decomposition(4), std::invalid_argument);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "../include/graph.hpp"
+
+class IncrementalComponentsTest : public ::testing::Test {
+protected:
+    Graph<int, int, int> graph;
+
+    void SetUp() override {
+        graph.track_components();
+        for (int i = 0; i < 6; ++i) {
+            graph.add_vertex(i, i);
+        }
+    }
+};
+
+TEST_F(IncrementalComponentsTest, InsertionsMergeComponents) {
+    EXPECT_EQ(graph.component_count(), 6);
+    EXPECT_FALSE(graph.same_component(0, 1));
+
+    graph.add_edge(0, 1, 1);
+    graph.add_edge(2, 3, 1);
+    EXPECT_EQ(graph.component_count(), 4);
+    EXPECT_TRUE(graph.same_component(0, 1));
+    EXPECT_FALSE(graph.same_component(1, 2));
+
+    graph.add_edge(1, 2, 1);
+    graph.add_vertex(6, 6);
+    EXPECT_EQ(graph.component_count(), 4);
+    EXPECT_TRUE(graph.same_component(0, 3));
+    EXPECT_FALSE(graph.same_component(0, 6));
+}
+
+TEST_F(IncrementalComponentsTest, RemovalsFallBackToRebuild) {
+    graph.add_edge(0, 1, 1);
+    graph.add_edge(1, 2, 1);
+    EXPECT_TRUE(graph.same_component(0, 2));
+
+    graph.remove_edge(1, 2);
+    EXPECT_FALSE(graph.same_component(0, 2));
+    EXPECT_EQ(graph.component_count(), 5);
+
+    // Insertions after the rebuild are tracked again
+    graph.add_edge(2, 5, 1);
+    EXPECT_EQ(graph.component_count(), 4);
+
+    graph.remove_vertex(0);
+    EXPECT_EQ(graph.component_count(), 4);
+    EXPECT_TRUE(graph.same_component(2, 5));
+    EXPECT_THROW(graph.same_component(0, 1), std::invalid_argument);
+}
+
+TEST_F(IncrementalComponentsTest, MatchesFullRecomputation) {
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> vertex(0, 199);
+    for (int i = 6; i < 200; ++i) {
+        graph.add_vertex(i, i);
+    }
+
+    for (int step = 0; step < 300; ++step) {
+        int a = vertex(rng);
+        int b = vertex(rng);
+        if (a == b || graph.has_edge(a, b)) {
+            continue;
+        }
+        graph.add_edge(a, b, 1);
+        if (step % 7 == 0) {
+            graph.remove_edge(a, b);
+        }
+        if (step % 25 == 0) {
+            EXPECT_EQ(graph.component_count(), graph.find_connected_components().size());
+        }
+    }
+
+    auto components = graph.find_connected_components();
+    EXPECT_EQ(graph.component_count(), components.size());
+    for (const auto& component : components) {
+        for (const auto& id : component) {
+            EXPECT_TRUE(graph.same_component(component[0], id));
+        }
+    }
+}
+
+TEST_F(IncrementalComponentsTest, WorksWithoutTrackingAndAfterGenerators) {
+    Graph<int, int, int> untracked;
+    untracked.generate_path_graph(5);
+    EXPECT_EQ(untracked.component_count(), 1);
+    untracked.remove_edge(1, 2);
+    EXPECT_EQ(untracked.component_count(), 2);
+    EXPECT_FALSE(untracked.same_component(0, 4));
+
+    Graph<int, int, int> copy = graph;
+    copy.add_edge(4, 5, 1);
+    EXPECT_TRUE(copy.same_component(4, 5));
+    EXPECT_FALSE(graph.same_component(4, 5));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "../include/graph.hpp"
+
+class JsonStreamTest : public ::testing::Test {
+protected:
+    Graph<int, int, double> graph;
+    const std::string filename = "json_stream_test.json";
+
+    void SetUp() override {
+        for (int i = 0; i < 8; ++i) {
+            graph.add_vertex(i * 3);
+        }
+        graph.add_edge(0, 3, 1.5);
+        graph.add_edge(3, 6, 2.0);
+        graph.add_edge(6, 9, 0.25);
+        graph.add_edge(0, 9, 4.0);
+        graph.add_edge(12, 15, 7.0);
+    }
+
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+};
+
+TEST_F(JsonStreamTest, WriterMatchesDom) {
+    std::ostringstream out;
+    graph.write_json(out);
+    EXPECT_EQ(json::parse(out.str()), graph.to_json());
+
+    // The loader can only reserve if the count is read before the edges
+    EXPECT_LT(out.str().find("\"vertex_count\""), out.str().find("\"edges\""));
+
+    Graph<int, int, double> empty;
+    std::ostringstream empty_out;
+    empty.write_json(empty_out);
+    EXPECT_EQ(json::parse(empty_out.str()), empty.to_json());
+}
+
+TEST_F(JsonStreamTest, RoundTrip) {
+    graph.save_to_json(filename);
+
+    Graph<int, int, double> loaded;
+    loaded.add_vertex(100);
+    loaded.load_from_json(filename);
+
+    // Ids are renumbered by slot on export
+    EXPECT_EQ(loaded.vertex_count(), graph.vertex_count());
+    EXPECT_EQ(loaded.edge_count(), graph.edge_count());
+    for (const auto& [from, row] : graph.get_adjacency_list()) {
+        for (const auto& [to, edge] : row) {
+            int a = static_cast<int>(graph.get_slot(from));
+            int b = static_cast<int>(graph.get_slot(to));
+            ASSERT_TRUE(loaded.has_edge(a, b));
+            EXPECT_DOUBLE_EQ(loaded.get_edge(a, b).get_weight(), edge->get_weight());
+        }
+    }
+    EXPECT_TRUE(loaded.has_vertex(static_cast<int>(graph.get_slot(21)))); // isolated vertex survives
+}
+
+TEST_F(JsonStreamTest, LoadsHandWrittenDocument) {
+    {
+        std::ofstream file(filename);
+        file << R"({"vertices": [{"id": 1, "extra": {"id": 42}}, {"id": 2}, {"id": 5}],
+                    "comment": [1, 2, {"from": 9}],
+                    "edges": [{"weight": 3, "to": 2, "from": 1}]})";
+    }
+
+    graph.load_from_json(filename);
+    EXPECT_EQ(graph.vertex_count(), 3);
+    EXPECT_FALSE(graph.has_vertex(42));
+    EXPECT_TRUE(graph.has_edge(1, 2));
+    EXPECT_DOUBLE_EQ(graph.get_edge(2, 1).get_weight(), 3.0);
+}
+
+TEST_F(JsonStreamTest, RejectsBrokenInput) {
+    {
+        std::ofstream file(filename);
+        file << R"({"edges": [{"from": 1, "to": 2}]})";
+    }
+    EXPECT_THROW(graph.load_from_json(filename), std::runtime_error);
+
+    {
+        std::ofstream file(filename);
+        file << R"({"vertices": [{"id": 1}, )";
+    }
+    EXPECT_THROW(graph.load_from_json(filename), std::runtime_error);
+
+    EXPECT_THROW(graph.load_from_json("missing_file.json"), std::runtime_error);
+}
+
+TEST_F(JsonStreamTest, VertexCountIsOnlyAHint) {
+    {
+        std::ofstream file(filename);
+        file << R"({"vertex_count": 1000000000000000000, "vertices": [{"id": 1}, {"id": 2}]})";
+    }
+    graph.load_from_json(filename);
+    EXPECT_EQ(graph.vertex_count(), 2);
+}
+
+TEST_F(JsonStreamTest, RejectsDuplicateVertexEntries) {
+    {
+        std::ofstream file(filename);
+        file << R"({"vertices": [{"id": 1}, {"id": 2}, {"id": 1}]})";
+    }
+    EXPECT_THROW(graph.load_from_json(filename), std::invalid_argument);
+
+    // An endpoint created by an edge may still get its own entry, but only once
+    {
+        std::ofstream file(filename);
+        file << R"({"edges": [{"from": 1, "to": 2, "weight": 1}], "vertices": [{"id": 1}, {"id": 2}, {"id": 2}]})";
+    }
+    EXPECT_THROW(graph.load_from_json(filename), std::invalid_argument);
+}
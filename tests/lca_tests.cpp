@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+// LCA by walking parents, for checking
+static int naive_lca(const LcaIndex<int>& index, int u, int v) {
+    while (index.depth(u) > index.depth(v)) u = index.parent(u);
+    while (index.depth(v) > index.depth(u)) v = index.parent(v);
+    while (u != v) {
+        u = index.parent(u);
+        v = index.parent(v);
+    }
+    return u;
+}
+
+TEST(LcaTest, SmallRootedTree) {
+    // Children: 0 -> {1, 2}, 1 -> {3, 4}, 2 -> {5}, 4 -> {6}
+    std::vector<EdgeTuple> edges = {{0, 1, 1}, {0, 2, 1}, {1, 3, 1}, {1, 4, 1}, {2, 5, 1}, {4, 6, 1}};
+    auto index = LcaIndex<int>::build(CsrGraph<int, int>::from_edge_list(edges));
+
+    EXPECT_EQ(index.lca(3, 6), 1);
+    EXPECT_EQ(index.lca(6, 5), 0);
+    EXPECT_EQ(index.lca(4, 6), 4);
+    EXPECT_EQ(index.lca(2, 2), 2);
+    EXPECT_EQ(index.depth(6), 3);
+    EXPECT_EQ(index.distance(3, 5), 4);
+    EXPECT_EQ(index.ancestor(6, 2), 1);
+    EXPECT_EQ(index.ancestor(6, 3), 0);
+    EXPECT_EQ(index.ancestor(6, 4), std::nullopt);
+
+    // Rerooting at 4 changes the answers
+    auto rerooted = LcaIndex<int>::build(CsrGraph<int, int>::from_edge_list(edges), 4);
+    EXPECT_EQ(rerooted.root(5), 4);
+    EXPECT_EQ(rerooted.lca(3, 5), 1);
+    EXPECT_EQ(rerooted.lca(6, 0), 4);
+}
+
+TEST(LcaTest, RandomTreeMatchesNaiveAndOffline) {
+    Graph<int, int, int> tree;
+    tree.generate_tree(3000);
+    auto index = tree.lca_index();
+
+    std::mt19937 rng(24);
+    std::uniform_int_distribution<int> vertex(0, 2999);
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < 2000; ++i) {
+        queries.emplace_back(vertex(rng), vertex(rng));
+    }
+
+    auto offline = index.lca(std::span<const std::pair<int, int>>(queries));
+    ASSERT_EQ(offline.size(), queries.size());
+    for (size_t q = 0; q < queries.size(); ++q) {
+        auto [u, v] = queries[q];
+        int expected = naive_lca(index, u, v);
+        EXPECT_EQ(index.lca(u, v), expected);
+        EXPECT_EQ(offline[q], expected);
+    }
+}
+
+TEST(LcaTest, ForestAndSpanningTreeInput) {
+    // The minimum spanning forest of a graph with two components
+    std::vector<EdgeTuple> edges = {{0, 1, 4}, {1, 2, 1}, {0, 2, 2}, {2, 3, 7}, {10, 11, 1}, {11, 12, 1}};
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto forest = csr.kruskal();
+
+    std::vector<EdgeTuple> tree_edges;
+    for (const auto& [u, v, weight] : forest.edges) {
+        tree_edges.emplace_back(csr.id_of(u), csr.id_of(v), weight);
+    }
+    auto index = LcaIndex<int>::build(CsrGraph<int, int>::from_edge_list(tree_edges));
+
+    EXPECT_EQ(index.lca(1, 3), 2);
+    EXPECT_EQ(index.lca(10, 12), 10);
+    EXPECT_EQ(index.lca(1, 12), std::nullopt);
+    EXPECT_EQ(index.distance(0, 11), std::nullopt);
+
+    std::vector<std::pair<int, int>> queries = {{1, 12}, {3, 0}};
+    auto offline = index.lca(std::span<const std::pair<int, int>>(queries));
+    EXPECT_EQ(offline[0], std::nullopt);
+    EXPECT_EQ(offline[1], 0);
+}
+
+TEST(LcaTest, DeepPathAndErrors) {
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i + 1 < 100000; ++i) {
+        edges.emplace_back(i, i + 1, 1);
+    }
+    auto index = LcaIndex<int>::build(CsrGraph<int, int>::from_edge_list(edges));
+    EXPECT_EQ(index.lca(99999, 50000), 50000);
+    EXPECT_EQ(index.ancestor(99999, 99999), 0);
+    EXPECT_THROW(index.lca(0, 100000), std::invalid_argument);
+
+    std::vector<EdgeTuple> cycle = {{0, 1, 1}, {1, 2, 1}, {2, 0, 1}};
+    EXPECT_THROW(LcaIndex<int>::build(CsrGraph<int, int>::from_edge_list(cycle)), std::runtime_error);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+static void expect_valid_matching(const CsrGraph<int, int>& csr, const CsrMatching& matching) {
+    ASSERT_EQ(matching.mates.size(), csr.vertex_count());
+    size_t matched = 0;
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        uint32_t mate = matching.mates[v];
+        if (mate == CsrMatching::unmatched) {
+            continue;
+        }
+        ++matched;
+        EXPECT_EQ(matching.mates[mate], v);
+        auto row = csr.neighbors(v);
+        EXPECT_NE(std::find(row.begin(), row.end(), mate), row.end());
+    }
+    EXPECT_EQ(matched, 2 * matching.size);
+}
+
+// Exhaustive maximum matching for small graphs
+static size_t brute_force_matching(const std::vector<std::pair<int, int>>& edges, size_t first, uint32_t used) {
+    size_t best = 0;
+    for (size_t i = first; i < edges.size(); ++i) {
+        auto [u, v] = edges[i];
+        if (!(used & (1u << u)) && !(used & (1u << v))) {
+            best = std::max(best, 1 + brute_force_matching(edges, i + 1, used | (1u << u) | (1u << v)));
+        }
+    }
+    return best;
+}
+
+static CsrGraph<int, int> random_bipartite(int left, int right, int edge_count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick_left(0, left - 1);
+    std::uniform_int_distribution<int> pick_right(left, left + right - 1);
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < edge_count; ++i) {
+        edges.emplace_back(pick_left(rng), pick_right(rng), 1);
+    }
+    return CsrGraph<int, int>::from_edge_list(edges);
+}
+
+TEST(MatchingTest, SmallBipartiteGraph) {
+    std::vector<EdgeTuple> edges = {{0, 3, 1}, {0, 4, 1}, {1, 3, 1}, {2, 3, 1}, {2, 5, 1}};
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+
+    for (const auto& matching : {csr.kuhn_matching(), csr.hopcroft_karp(), csr.parallel_matching(2),
+                                 csr.edmonds_matching()}) {
+        expect_valid_matching(csr, matching);
+        EXPECT_EQ(matching.size, 3);
+    }
+}
+
+TEST(MatchingTest, BipartiteAlgorithmsAgree) {
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        // Sparse enough that Karp-Sipser leaves augmenting paths to find
+        auto csr = random_bipartite(2000, 1800, 3500, seed);
+        auto expected = csr.hopcroft_karp();
+        expect_valid_matching(csr, expected);
+
+        auto by_kuhn = csr.kuhn_matching();
+        expect_valid_matching(csr, by_kuhn);
+        EXPECT_EQ(by_kuhn.size, expected.size);
+
+        for (size_t threads : {1, 2, 4}) {
+            auto parallel = csr.parallel_matching(threads);
+            expect_valid_matching(csr, parallel);
+            EXPECT_EQ(parallel.size, expected.size);
+        }
+
+        auto by_edmonds = csr.edmonds_matching();
+        expect_valid_matching(csr, by_edmonds);
+        EXPECT_EQ(by_edmonds.size, expected.size);
+    }
+}
+
+TEST(MatchingTest, EdmondsOnGeneralGraphs) {
+    std::mt19937 rng(22);
+    std::uniform_int_distribution<int> vertex(0, 11);
+    for (int round = 0; round < 40; ++round) {
+        std::vector<EdgeTuple> edges;
+        std::vector<std::pair<int, int>> pairs;
+        for (int i = 0; i < 16; ++i) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a != b) {
+                edges.emplace_back(a, b, 1);
+            }
+        }
+        auto csr = CsrGraph<int, int>::from_edge_list(edges);
+        for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+            for (uint32_t neighbor : csr.neighbors(v)) {
+                if (v < neighbor) {
+                    pairs.emplace_back(v, neighbor);
+                }
+            }
+        }
+
+        auto matching = csr.edmonds_matching();
+        expect_valid_matching(csr, matching);
+        EXPECT_EQ(matching.size, brute_force_matching(pairs, 0, 0));
+    }
+}
+
+TEST(MatchingTest, PetersenGraphIsPerfectlyMatched) {
+    // 3-regular with 5-cycles everywhere, so the degree one rule never applies and augmenting paths
+    // have to pass through blossoms
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 5; ++i) {
+        edges.emplace_back(i, (i + 1) % 5, 1);
+        edges.emplace_back(i, i + 5, 1);
+        edges.emplace_back(i + 5, (i + 2) % 5 + 5, 1);
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto matching = csr.edmonds_matching();
+    expect_valid_matching(csr, matching);
+    EXPECT_EQ(matching.size, 5);
+    EXPECT_THROW(csr.hopcroft_karp(), std::runtime_error);
+    EXPECT_THROW(csr.kuhn_matching(), std::runtime_error);
+}
+
+TEST(MatchingTest, GraphPairLists) {
+    Graph<int, int, int> graph;
+    graph.generate_complete_bipartite_graph(3, 5);
+
+    for (const auto& result : {graph.hopcroft_karp(), graph.kuhn_max_matching(), graph.edmonds_max_matching()}) {
+        EXPECT_EQ(result.pairs.size(), 3);
+        std::vector<bool> right_used(8, false);
+        for (const auto& [left, right] : result.pairs) {
+            EXPECT_LT(left, 3);
+            EXPECT_GE(right, 3);
+            EXPECT_FALSE(right_used[right]);
+            right_used[right] = true;
+        }
+    }
+
+    Graph<int, int, int> empty;
+    EXPECT_THROW(empty.hopcroft_karp(), std::runtime_error);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+static std::vector<int> reference_levels(const CsrGraph<int, int>& csr, uint32_t source) {
+    std::vector<int> levels(csr.vertex_count(), -1);
+    std::queue<uint32_t> queue;
+    levels[source] = 0;
+    queue.push(source);
+    while (!queue.empty()) {
+        uint32_t u = queue.front();
+        queue.pop();
+        for (uint32_t v : csr.neighbors(u)) {
+            if (levels[v] == -1) {
+                levels[v] = levels[u] + 1;
+                queue.push(v);
+            }
+        }
+    }
+    return levels;
+}
+
+static void expect_valid_tree(const CsrGraph<int, int>& csr, const CsrBfsTree& tree, uint32_t source) {
+    EXPECT_EQ(tree.levels, reference_levels(csr, source));
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        uint32_t parent = tree.parents[v];
+        if (v == source || tree.levels[v] == -1) {
+            EXPECT_EQ(parent, v);
+            continue;
+        }
+        EXPECT_EQ(tree.levels[parent], tree.levels[v] - 1);
+        auto neighbors = csr.neighbors(v);
+        EXPECT_TRUE(std::binary_search(neighbors.begin(), neighbors.end(), parent));
+    }
+}
+
+TEST(ParallelBfsTest, RandomLowDiameterGraph) {
+    // Dense enough that the middle levels run bottom-up
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, 1999);
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 30000; ++i) {
+        int a = pick(rng);
+        int b = pick(rng);
+        if (a != b) {
+            edges.emplace_back(a, b, 1);
+        }
+    }
+    edges.emplace_back(5000, 5001, 1); // separate component
+
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    uint32_t source = csr.index_of(std::get<0>(edges.front()));
+
+    for (size_t threads : {1, 2, 4}) {
+        auto tree = csr.parallel_breadth_first_search(csr.id_of(source), threads);
+        expect_valid_tree(csr, tree, source);
+        EXPECT_EQ(tree.levels[csr.index_of(5000)], -1);
+    }
+}
+
+TEST(ParallelBfsTest, LongPathStaysTopDown) {
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 500; ++i) {
+        edges.emplace_back(i, i + 1, 1);
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+
+    auto tree = csr.parallel_breadth_first_search(250, 3);
+    expect_valid_tree(csr, tree, csr.index_of(250));
+    EXPECT_EQ(tree.levels[csr.index_of(0)], 250);
+    EXPECT_EQ(tree.levels[csr.index_of(500)], 250);
+}
+
+TEST(ParallelBfsTest, StarSwitchesImmediately) {
+    Graph<int, int, int> graph;
+    graph.generate_star_graph(200);
+    auto csr = graph.freeze();
+
+    auto tree = csr.parallel_breadth_first_search(csr.id_of(0), 2);
+    expect_valid_tree(csr, tree, 0);
+}
+
+TEST(ParallelBfsTest, MissingStart) {
+    auto csr = CsrGraph<int, int>::from_edge_list(std::vector<EdgeTuple>{{1, 2, 1}});
+    EXPECT_THROW(csr.parallel_breadth_first_search(3), std::runtime_error);
+
+    CsrGraph<int, int> empty;
+    EXPECT_THROW(empty.parallel_breadth_first_search(1), std::runtime_error);
+}
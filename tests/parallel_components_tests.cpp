@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+static void expect_same_components(const CsrGraph<int, int>& csr) {
+    auto expected = csr.find_connected_components();
+    for (size_t threads : {1, 2, 4}) {
+        auto actual = csr.parallel_connected_components(threads);
+        EXPECT_EQ(actual.count, expected.count);
+        EXPECT_EQ(actual.labels, expected.labels);
+    }
+}
+
+TEST(ParallelComponentsTest, RandomSparseGraph) {
+    std::mt19937 rng(16);
+    std::uniform_int_distribution<int> vertex(0, 4999);
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 4000; ++i) {
+        int a = vertex(rng);
+        int b = vertex(rng);
+        if (a != b) {
+            edges.emplace_back(a, b, 1);
+        }
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    expect_same_components(csr);
+}
+
+TEST(ParallelComponentsTest, GiantComponentWithIsolatedPieces) {
+    Graph<int, int, int> graph;
+    graph.generate_grid_graph(60, 60);
+    for (int i = 0; i < 50; ++i) {
+        graph.add_vertex(10000 + 2 * i, 0);
+        graph.add_vertex(10001 + 2 * i, 0);
+        graph.add_edge(10000 + 2 * i, 10001 + 2 * i, 1);
+    }
+    graph.add_vertex(20000, 0);
+
+    auto csr = graph.freeze();
+    expect_same_components(csr);
+    EXPECT_EQ(csr.parallel_connected_components().count, 52);
+}
+
+TEST(ParallelComponentsTest, LongPathIsOneComponent) {
+    // A path with descending ids makes every link walk up the tree
+    std::vector<EdgeTuple> edges;
+    for (int i = 3000; i > 0; --i) {
+        edges.emplace_back(i, i - 1, 1);
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    auto result = csr.parallel_connected_components(3);
+    EXPECT_EQ(result.count, 1);
+    expect_same_components(csr);
+}
+
+TEST(ParallelComponentsTest, EmptyGraphThrows) {
+    CsrGraph<int, int> empty;
+    EXPECT_THROW(empty.parallel_connected_components(), std::runtime_error);
+}
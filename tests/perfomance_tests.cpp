@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cstdio>
 #include <fstream>
+#include <random>
 #include "../include/graph.hpp"
+#include "../include/contraction_hierarchy.hpp"
 
 struct Resource {
     std::string name;
@@ -47,6 +50,54 @@ TEST_F(GraphPerformanceTest, LargeGraphOperations) {
         });
         SaveBenchmarkResult("generate_graph", size, gen_time);
 
+        CsrGraph<int, double> csr;
+        double freeze_time = BenchmarkOperation([&]() {
+            csr = graph.freeze();
+        });
+        SaveBenchmarkResult("freeze", size, freeze_time);
+
+        csr.save_binary("benchmark_graph.bin");
+        double map_time = BenchmarkOperation([&]() {
+            auto mapped = CsrGraph<int, double>::map_binary("benchmark_graph.bin");
+            mapped.breadth_first_search(0);
+        });
+        SaveBenchmarkResult("map_binary_bfs", size, map_time);
+        std::remove("benchmark_graph.bin");
+
+        double csr_bfs_time = BenchmarkOperation([&]() {
+            csr.breadth_first_search(0);
+        });
+        SaveBenchmarkResult("csr_bfs", size, csr_bfs_time);
+
+        double parallel_bfs_time = BenchmarkOperation([&]() {
+            csr.parallel_breadth_first_search(0);
+        });
+        SaveBenchmarkResult("parallel_bfs", size, parallel_bfs_time);
+
+        double csr_dijkstra_time = BenchmarkOperation([&]() {
+            csr.dijkstra(0);
+        });
+        SaveBenchmarkResult("csr_dijkstra", size, csr_dijkstra_time);
+
+        double delta_stepping_time = BenchmarkOperation([&]() {
+            csr.delta_stepping(0);
+        });
+        SaveBenchmarkResult("delta_stepping", size, delta_stepping_time);
+
+        std::vector<int> sources;
+        for (size_t i = 0; i < 64; ++i) {
+            sources.push_back(static_cast<int>(i * (size / 64)));
+        }
+        double distance_matrix_time = BenchmarkOperation([&]() {
+            csr.distance_matrix(sources);
+        });
+        SaveBenchmarkResult("distance_matrix_64", size, distance_matrix_time);
+
+        double bit_parallel_bfs_time = BenchmarkOperation([&]() {
+            csr.unweighted_distance_matrix(sources);
+        });
+        SaveBenchmarkResult("bit_parallel_bfs_64", size, bit_parallel_bfs_time);
+
         // Test BFS
         double bfs_time = BenchmarkOperation([&]() {
             graph.breadth_first_search(0);
@@ -65,10 +116,234 @@ TEST_F(GraphPerformanceTest, LargeGraphOperations) {
         });
         SaveBenchmarkResult("connected_components", size, cc_time);
 
+        double parallel_cc_time = BenchmarkOperation([&]() {
+            csr.parallel_connected_components();
+        });
+        SaveBenchmarkResult("parallel_connected_components", size, parallel_cc_time);
+
+        // Test bridges and articulation points
+        double biconnectivity_time = BenchmarkOperation([&]() {
+            csr.biconnectivity();
+        });
+        SaveBenchmarkResult("biconnectivity", size, biconnectivity_time);
+
+        double parallel_biconnectivity_time = BenchmarkOperation([&]() {
+            csr.parallel_biconnectivity();
+        });
+        SaveBenchmarkResult("parallel_biconnectivity", size, parallel_biconnectivity_time);
+
         // Test coloring
         double coloring_time = BenchmarkOperation([&]() {
             graph.greedy_coloring(0);
         });
         SaveBenchmarkResult("greedy_coloring", size, coloring_time);
+
+        double welsh_powell_time = BenchmarkOperation([&]() {
+            csr.welsh_powell_coloring();
+        });
+        SaveBenchmarkResult("welsh_powell_coloring", size, welsh_powell_time);
+
+        double parallel_coloring_time = BenchmarkOperation([&]() {
+            csr.parallel_coloring();
+        });
+        SaveBenchmarkResult("parallel_coloring", size, parallel_coloring_time);
+    }
+}
+
+TEST_F(GraphPerformanceTest, DijkstraQueuePolicies) {
+    const std::vector<size_t> sizes = {10000, 100000};
+
+    for (size_t size : sizes) {
+        Graph<int, int, int> graph;
+        for (size_t i = 0; i < size; ++i) {
+            graph.add_vertex(i);
+        }
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = i + 1; j < std::min(i + 10, size); ++j) {
+                graph.add_edge(i, j, static_cast<int>((i * 7 + j * 13) % 100));
+            }
+        }
+
+        SaveBenchmarkResult("dijkstra_lazy_queue", size, BenchmarkOperation([&]() {
+            graph.dijkstra(0);
+        }));
+        SaveBenchmarkResult("dijkstra_binary_heap", size, BenchmarkOperation([&]() {
+            graph.dijkstra<BinaryHeap>(0);
+        }));
+        SaveBenchmarkResult("dijkstra_4ary_heap", size, BenchmarkOperation([&]() {
+            graph.dijkstra<IndexedFourAryHeap>(0);
+        }));
+        SaveBenchmarkResult("dijkstra_radix_heap", size, BenchmarkOperation([&]() {
+            graph.dijkstra<RadixHeap>(0);
+        }));
+        SaveBenchmarkResult("dijkstra_dial", size, BenchmarkOperation([&]() {
+            graph.dijkstra<DialBuckets>(0);
+        }));
+    }
+}
+
+TEST_F(GraphPerformanceTest, MinimumSpanningForests) {
+    const std::vector<size_t> sizes = {100000, 1000000};
+
+    for (size_t size : sizes) {
+        // A banded graph with local edges and a random one with the same edge count
+        std::mt19937 rng(static_cast<unsigned>(size));
+        std::uniform_int_distribution<int> weight(1, 1000000);
+        std::uniform_int_distribution<size_t> vertex(0, size - 1);
+        std::vector<std::tuple<size_t, size_t, int>> banded;
+        std::vector<std::tuple<size_t, size_t, int>> random;
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = i + 1; j < std::min(i + 10, size); ++j) {
+                banded.emplace_back(i, j, weight(rng));
+                random.emplace_back(vertex(rng), vertex(rng), weight(rng));
+            }
+        }
+        std::erase_if(random, [](const auto& edge) { return std::get<0>(edge) == std::get<1>(edge); });
+
+        for (const auto& [shape, edges] : {std::pair{"banded", &banded}, std::pair{"random", &random}}) {
+            auto csr = CsrGraph<size_t, int>::from_edge_list(*edges);
+            SaveBenchmarkResult(std::string("kruskal_") + shape, size, BenchmarkOperation([&]() {
+                csr.kruskal();
+            }));
+            SaveBenchmarkResult(std::string("prim_") + shape, size, BenchmarkOperation([&]() {
+                csr.prim();
+            }));
+            SaveBenchmarkResult(std::string("boruvka_") + shape, size, BenchmarkOperation([&]() {
+                csr.boruvka();
+            }));
+        }
+    }
+}
+
+TEST_F(GraphPerformanceTest, BipartiteMatchings) {
+    const std::vector<size_t> sizes = {100000, 1000000};
+
+    for (size_t size : sizes) {
+        // Left vertices [0, size / 2), three random right neighbors each
+        std::mt19937 rng(static_cast<unsigned>(size));
+        std::uniform_int_distribution<size_t> right(size / 2, size - 1);
+        std::vector<std::tuple<size_t, size_t, int>> edges;
+        for (size_t left = 0; left < size / 2; ++left) {
+            for (int k = 0; k < 3; ++k) {
+                edges.emplace_back(left, right(rng), 1);
+            }
+        }
+        auto csr = CsrGraph<size_t, int>::from_edge_list(edges);
+
+        SaveBenchmarkResult("kuhn_matching", size, BenchmarkOperation([&]() {
+            csr.kuhn_matching();
+        }));
+        SaveBenchmarkResult("hopcroft_karp", size, BenchmarkOperation([&]() {
+            csr.hopcroft_karp();
+        }));
+        SaveBenchmarkResult("parallel_matching", size, BenchmarkOperation([&]() {
+            csr.parallel_matching();
+        }));
+    }
+}
+
+TEST_F(GraphPerformanceTest, LcaQueries) {
+    const std::vector<size_t> sizes = {100000, 1000000};
+
+    for (size_t size : sizes) {
+        std::mt19937 rng(static_cast<unsigned>(size));
+        std::vector<std::tuple<size_t, size_t, int>> edges;
+        for (size_t v = 1; v < size; ++v) {
+            edges.emplace_back(std::uniform_int_distribution<size_t>(0, v - 1)(rng), v, 1);
+        }
+        auto csr = CsrGraph<size_t, int>::from_edge_list(edges);
+
+        LcaIndex<size_t> index;
+        SaveBenchmarkResult("lca_index_build", size, BenchmarkOperation([&]() {
+            index = LcaIndex<size_t>::build(csr);
+        }));
+
+        std::uniform_int_distribution<size_t> vertex(0, size - 1);
+        std::vector<std::pair<size_t, size_t>> queries(size);
+        for (auto& query : queries) {
+            query = {vertex(rng), vertex(rng)};
+        }
+        SaveBenchmarkResult("lca_sparse_table_queries", size, BenchmarkOperation([&]() {
+            for (const auto& [u, v] : queries) {
+                index.lca(u, v);
+            }
+        }));
+        SaveBenchmarkResult("lca_offline_tarjan_queries", size, BenchmarkOperation([&]() {
+            index.lca(std::span<const std::pair<size_t, size_t>>(queries));
+        }));
+    }
+}
+
+TEST_F(GraphPerformanceTest, HeavyLightPathQueries) {
+    const std::vector<size_t> sizes = {100000, 1000000};
+
+    for (size_t size : sizes) {
+        std::mt19937 rng(static_cast<unsigned>(size));
+        std::uniform_int_distribution<int> weight(1, 1000);
+        std::vector<std::tuple<size_t, size_t, int>> edges;
+        for (size_t v = 1; v < size; ++v) {
+            edges.emplace_back(std::uniform_int_distribution<size_t>(0, v - 1)(rng), v, weight(rng));
+        }
+        auto csr = CsrGraph<size_t, int>::from_edge_list(edges);
+
+        HeavyLightDecomposition<size_t, int> hld;
+        SaveBenchmarkResult("heavy_light_build", size, BenchmarkOperation([&]() {
+            hld = HeavyLightDecomposition<size_t, int>::build(csr);
+        }));
+
+        std::uniform_int_distribution<size_t> vertex(0, size - 1);
+        std::vector<std::pair<size_t, size_t>> queries(size);
+        for (auto& query : queries) {
+            query = {vertex(rng), vertex(rng)};
+        }
+        SaveBenchmarkResult("heavy_light_path_max_queries", size, BenchmarkOperation([&]() {
+            for (const auto& [u, v] : queries) {
+                hld.path_max(u, v);
+            }
+        }));
+        SaveBenchmarkResult("heavy_light_edge_updates", size, BenchmarkOperation([&]() {
+            for (size_t i = 0; i < size; ++i) {
+                const auto& [u, v, w] = edges[i % edges.size()];
+                hld.set_edge_weight(u, v, w + 1);
+            }
+        }));
+    }
+}
+
+TEST_F(GraphPerformanceTest, ContractionHierarchyQueries) {
+    const std::vector<size_t> sides = {50, 100};
+
+    for (size_t side : sides) {
+        Graph<int, int, int> graph;
+        graph.generate_grid_graph(side, side);
+        for (const auto& [from, row] : graph.get_adjacency_list()) {
+            for (const auto& [to, edge] : row) {
+                if (from < to) {
+                    graph.set_edge_weight(from, to, 1 + (from * 31 + to * 17) % 50);
+                }
+            }
+        }
+        const size_t size = side * side;
+
+        ContractionHierarchy<int, int> hierarchy;
+        SaveBenchmarkResult("ch_build", size, BenchmarkOperation([&]() {
+            hierarchy = ContractionHierarchy<int, int>::build(graph);
+        }));
+
+        ContractionHierarchy<int, int>::Query query(hierarchy);
+        SaveBenchmarkResult("ch_1000_queries", size, BenchmarkOperation([&]() {
+            for (size_t i = 0; i < 1000; ++i) {
+                query.distance(static_cast<int>((i * 7919) % size), static_cast<int>((i * 104729) % size));
+            }
+        }));
+
+        Graph<int, int, int>::Workspace forward;
+        Graph<int, int, int>::Workspace backward;
+        SaveBenchmarkResult("bidirectional_1000_queries", size, BenchmarkOperation([&]() {
+            for (size_t i = 0; i < 1000; ++i) {
+                graph.shortest_path(static_cast<int>((i * 7919) % size), static_cast<int>((i * 104729) % size),
+                                    forward, backward);
+            }
+        }));
     }
 }
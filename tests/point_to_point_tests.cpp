@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "../include/graph.hpp"
+
+class PointToPointTest : public ::testing::Test {
+protected:
+    static constexpr int side = 30;
+    Graph<int, int, int> graph;
+
+    void SetUp() override {
+        graph.generate_grid_graph(side, side);
+        std::mt19937 rng(21);
+        for (const auto& [from, row] : graph.get_adjacency_list()) {
+            for (const auto& [to, edge] : row) {
+                if (from < to) {
+                    graph.set_edge_weight(from, to, 1 + static_cast<int>(rng() % 9));
+                }
+            }
+        }
+    }
+
+    void expect_valid_path(const PathResult<int, int>& result, int source, int target) {
+        ASSERT_TRUE(result.found());
+        EXPECT_EQ(result.path[0], source);
+        EXPECT_EQ(result.path[result.path.size() - 1], target);
+        int length = 0;
+        for (size_t i = 0; i + 1 < result.path.size(); ++i) {
+            ASSERT_TRUE(graph.has_edge(result.path[i], result.path[i + 1]));
+            length += graph.get_edge(result.path[i], result.path[i + 1]).get_weight();
+        }
+        EXPECT_EQ(length, result.distance);
+    }
+};
+
+TEST_F(PointToPointTest, BidirectionalMatchesDijkstra) {
+    auto csr = graph.freeze();
+    std::mt19937 rng(4);
+    for (int query = 0; query < 20; ++query) {
+        int source = static_cast<int>(rng() % (side * side));
+        int target = static_cast<int>(rng() % (side * side));
+        auto expected = csr.dijkstra(source);
+
+        auto result = graph.shortest_path(source, target);
+        expect_valid_path(result, source, target);
+        EXPECT_EQ(result.distance, expected.distances[csr.index_of(target)]);
+    }
+}
+
+TEST_F(PointToPointTest, AStarMatchesDijkstra) {
+    auto csr = graph.freeze();
+    const int target = side * side - 1;
+    auto expected = csr.dijkstra(target);
+
+    // Manhattan distance times the minimum weight is a consistent estimate on the grid
+    auto manhattan = [](int vertex) {
+        return std::abs(vertex / side - (side - 1)) + std::abs(vertex % side - (side - 1));
+    };
+
+    auto guided = graph.shortest_path(0, target, manhattan);
+    expect_valid_path(guided, 0, target);
+    EXPECT_EQ(guided.distance, expected.distances[csr.index_of(0)]);
+
+    auto blind = graph.shortest_path(0, target, [](int) { return 0; });
+    EXPECT_EQ(blind.distance, guided.distance);
+    EXPECT_LE(guided.settled, blind.settled);
+}
+
+TEST_F(PointToPointTest, StopsEarlyOnNearbyTarget) {
+    auto result = graph.shortest_path(0, 1);
+    expect_valid_path(result, 0, 1);
+    EXPECT_LT(result.settled, static_cast<size_t>(side * side / 4));
+
+    auto a_star = graph.shortest_path(0, 1, [](int) { return 0; });
+    EXPECT_EQ(a_star.distance, result.distance);
+    EXPECT_LT(a_star.settled, static_cast<size_t>(side * side / 4));
+}
+
+TEST_F(PointToPointTest, UnreachableAndTrivialQueries) {
+    graph.add_vertex(5000);
+    EXPECT_FALSE(graph.shortest_path(0, 5000).found());
+    EXPECT_FALSE(graph.shortest_path(0, 5000, [](int) { return 0; }).found());
+
+    auto same = graph.shortest_path(7, 7);
+    ASSERT_TRUE(same.found());
+    EXPECT_EQ(same.distance, 0);
+    EXPECT_EQ(same.path.size(), 1);
+
+    EXPECT_THROW(graph.shortest_path(0, 9999), std::runtime_error);
+}
+
+TEST_F(PointToPointTest, NegativeWeight) {
+    graph.set_edge_weight(0, 1, -3);
+    EXPECT_THROW(graph.shortest_path(0, side * side - 1), std::runtime_error);
+}
+
+TEST_F(PointToPointTest, NegativeWeightOutsideSearchedRegion) {
+    // The far corner is never scanned by a query between two neighbours of vertex 0
+    graph.set_edge_weight(side * side - 2, side * side - 1, -3);
+    EXPECT_THROW(graph.shortest_path(0, 1), std::runtime_error);
+    EXPECT_THROW(graph.shortest_path(0, 1, [](int) { return 0; }), std::runtime_error);
+}
+
+TEST_F(PointToPointTest, ReusedWorkspacesMatchFreshQueries) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace forward;
+    Graph<int, int, int>::Workspace backward;
+    std::mt19937 rng(8);
+    for (int query = 0; query < 30; ++query) {
+        int source = static_cast<int>(rng() % (side * side));
+        int target = static_cast<int>(rng() % (side * side));
+        auto expected = shared.shortest_path(source, target);
+
+        auto result = shared.shortest_path(source, target, forward, backward);
+        expect_valid_path(result, source, target);
+        EXPECT_EQ(result.distance, expected.distance);
+        EXPECT_EQ(result.settled, expected.settled);
+
+        auto a_star = shared.shortest_path(source, target, [](int) { return 0; }, forward);
+        EXPECT_EQ(a_star.distance, expected.distance);
+    }
+
+    EXPECT_THROW(shared.shortest_path(0, 1, forward, forward), std::runtime_error);
+}
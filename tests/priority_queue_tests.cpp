@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "../include/graph.hpp"
+
+// Runs a monotone push/pop workload like Dijkstra's and checks that pops come out in order
+template <template <typename> class Queue>
+static void check_monotone_order(bool decrease_key) {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> step(0, 50);
+    const size_t vertex_count = 500;
+
+    Queue<int> queue(vertex_count, 50);
+    std::vector<int> best(vertex_count, std::numeric_limits<int>::max());
+    std::vector<bool> done(vertex_count, false);
+
+    best[0] = 0;
+    queue.push(0, 0);
+    int last = 0;
+    size_t popped = 0;
+
+    while (!queue.empty()) {
+        auto [distance, vertex] = queue.pop();
+        ASSERT_GE(distance, last);
+        last = distance;
+        if (distance > best[vertex]) {
+            ASSERT_FALSE(decrease_key) << "indexed heaps must not return stale entries";
+            continue;
+        }
+        ASSERT_FALSE(done[vertex]);
+        done[vertex] = true;
+        ++popped;
+
+        for (int k = 0; k < 4; ++k) {
+            uint32_t next = rng() % vertex_count;
+            int candidate = distance + step(rng);
+            if (!done[next] && candidate < best[next]) {
+                best[next] = candidate;
+                queue.push(next, candidate);
+            }
+        }
+    }
+    EXPECT_GT(popped, vertex_count / 2);
+}
+
+TEST(PriorityQueueTest, BinaryHeap) {
+    check_monotone_order<BinaryHeap>(false);
+}
+
+TEST(PriorityQueueTest, IndexedFourAryHeap) {
+    check_monotone_order<IndexedFourAryHeap>(true);
+}
+
+TEST(PriorityQueueTest, RadixHeap) {
+    check_monotone_order<RadixHeap>(false);
+}
+
+TEST(PriorityQueueTest, DialBuckets) {
+    check_monotone_order<DialBuckets>(false);
+}
+
+TEST(PriorityQueueTest, IndexedHeapDecreaseKey) {
+    IndexedDaryHeap<double, 2> heap(4, 0.0);
+    heap.push(0, 5.0);
+    heap.push(1, 3.0);
+    heap.push(2, 4.0);
+    heap.push(0, 1.0); // decrease
+    heap.push(1, 9.0); // larger key is ignored
+    EXPECT_EQ(heap.size(), 3);
+    EXPECT_EQ(heap.pop().second, 0);
+    EXPECT_EQ(heap.pop().second, 1);
+    EXPECT_FALSE(heap.contains(1));
+    EXPECT_EQ(heap.pop().second, 2);
+    EXPECT_TRUE(heap.empty());
+}
+
+template <template <typename> class Queue>
+static void check_against_csr(Graph<int, int, int>& graph, const CsrGraph<int, int>& csr) {
+    auto expected = csr.dijkstra(0);
+    auto result = graph.dijkstra<Queue>(0);
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        int id = csr.id_of(v);
+        ASSERT_TRUE(result.reached(id));
+        EXPECT_EQ(result.distances.at(id), expected.distances[v]);
+        if (id != 0) {
+            int parent = result.previous.at(id);
+            EXPECT_EQ(result.distances.at(parent) + graph.get_edge(parent, id).get_weight(), result.distances.at(id));
+        }
+    }
+
+    auto csr_result = csr.dijkstra<Queue>(0);
+    EXPECT_EQ(csr_result.distances, expected.distances);
+}
+
+TEST(PriorityQueueTest, DijkstraPolicies) {
+    Graph<int, int, int> graph;
+    graph.generate_grid_graph(25, 25);
+    std::mt19937 rng(9);
+    for (const auto& [from, row] : graph.get_adjacency_list()) {
+        for (const auto& [to, edge] : row) {
+            if (from < to) {
+                graph.set_edge_weight(from, to, static_cast<int>(rng() % 20));
+            }
+        }
+    }
+    auto csr = graph.freeze();
+
+    check_against_csr<BinaryHeap>(graph, csr);
+    check_against_csr<IndexedFourAryHeap>(graph, csr);
+    check_against_csr<RadixHeap>(graph, csr);
+    check_against_csr<DialBuckets>(graph, csr);
+}
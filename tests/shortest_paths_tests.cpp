@@ -31,7 +31,7 @@ TEST_F(ShortestPathsTest, NonExistentStartVertex) {
 
 TEST_F(ShortestPathsTest, SingleVertex) {
     graph.add_vertex(0, TestResource(0));
-    graph.shortest_paths_unweighted(0);
+    graph.export_shortest_paths_unweighted(graph.shortest_paths_unweighted(0));
     
     auto result = getResultsFromFile();
     EXPECT_EQ(result["distances"]["0"], 0);
@@ -46,7 +46,7 @@ TEST_F(ShortestPathsTest, SimplePath) {
     graph.add_edge(0, 1, 1);
     graph.add_edge(1, 2, 1);
     
-    graph.shortest_paths_unweighted(0);
+    graph.export_shortest_paths_unweighted(graph.shortest_paths_unweighted(0));
     
     auto result = getResultsFromFile();
     EXPECT_EQ(result["distances"]["0"], 0);
@@ -67,7 +67,7 @@ TEST_F(ShortestPathsTest, GraphWithCycle) {
     graph.add_edge(1, 2, 1);
     graph.add_edge(2, 0, 1);
      
-    graph.shortest_paths_unweighted(0);
+    graph.export_shortest_paths_unweighted(graph.shortest_paths_unweighted(0));
      
     auto result = getResultsFromFile();
     EXPECT_EQ(result["distances"]["0"], 0);
@@ -81,7 +81,7 @@ TEST_F(ShortestPathsTest, DisconnectedGraph) {
     graph.add_vertex(2, TestResource(2));
     graph.add_edge(0, 1, 1);
      
-    graph.shortest_paths_unweighted(0);
+    graph.export_shortest_paths_unweighted(graph.shortest_paths_unweighted(0));
     
     auto result = getResultsFromFile();
     EXPECT_EQ(result["distances"]["0"], 0);
@@ -99,7 +99,7 @@ TEST_F(ShortestPathsTest, MultiplePathsGraph) {
     graph.add_edge(0, 2, 1);
     graph.add_edge(2, 3, 1);
     
-    graph.shortest_paths_unweighted(0);
+    graph.export_shortest_paths_unweighted(graph.shortest_paths_unweighted(0));
     
     auto result = getResultsFromFile();
     EXPECT_EQ(result["distances"]["0"], 0);
@@ -107,3 +107,25 @@ TEST_F(ShortestPathsTest, MultiplePathsGraph) {
     EXPECT_EQ(result["distances"]["2"], 1);
     EXPECT_EQ(result["distances"]["3"], 2);
 }
+
+TEST_F(ShortestPathsTest, ResultWithoutExport) {
+    graph.add_vertex(0, TestResource(0));
+    graph.add_vertex(1, TestResource(1));
+    graph.add_vertex(2, TestResource(2));
+    graph.add_vertex(3, TestResource(3));
+    graph.add_edge(0, 1, 1);
+    graph.add_edge(1, 2, 1);
+
+    auto result = graph.shortest_paths_unweighted(0);
+
+    EXPECT_EQ(result.start, 0);
+    EXPECT_EQ(result.distances.at(2), 2);
+    EXPECT_FALSE(result.reached(3));
+    EXPECT_EQ(result.path_to(3).size(), 0);
+
+    auto path = result.path_to(2);
+    ASSERT_EQ(path.size(), 3);
+    EXPECT_EQ(path[0], 0);
+    EXPECT_EQ(path[1], 1);
+    EXPECT_EQ(path[2], 2);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include "../include/graph.hpp"
+
+using EdgeTuple = std::tuple<int, int, int>;
+
+// The forest has no cycles and joins exactly the components of the graph
+static void expect_spanning_forest(const CsrGraph<int, int>& csr, const CsrSpanningForest<int>& forest) {
+    DisjointSets sets(csr.vertex_count());
+    int total = 0;
+    for (const auto& [u, v, weight] : forest.edges) {
+        EXPECT_LT(u, v);
+        EXPECT_TRUE(sets.unite(u, v));
+        total += weight;
+    }
+    EXPECT_EQ(total, forest.total_weight);
+    EXPECT_EQ(sets.set_count(), csr.find_connected_components().count);
+}
+
+static void expect_same_forests(const CsrGraph<int, int>& csr) {
+    auto expected = csr.kruskal(1);
+    expect_spanning_forest(csr, expected);
+
+    auto by_prim = csr.prim();
+    expect_spanning_forest(csr, by_prim);
+    EXPECT_EQ(by_prim.total_weight, expected.total_weight);
+
+    for (size_t threads : {1, 2, 4}) {
+        EXPECT_EQ(csr.kruskal(threads).edges, expected.edges);
+        auto by_boruvka = csr.boruvka(threads);
+        EXPECT_EQ(by_boruvka.edges, expected.edges);
+        EXPECT_EQ(by_boruvka.total_weight, expected.total_weight);
+    }
+}
+
+TEST(SpanningForestTest, SmallWeightedGraph) {
+    Graph<int, int, int> graph;
+    for (int i = 0; i < 5; ++i) {
+        graph.add_vertex(i, 0);
+    }
+    graph.add_edge(0, 1, 2);
+    graph.add_edge(0, 3, 6);
+    graph.add_edge(1, 2, 3);
+    graph.add_edge(1, 3, 8);
+    graph.add_edge(1, 4, 5);
+    graph.add_edge(2, 4, 7);
+    graph.add_edge(3, 4, 9);
+
+    for (const auto& result : {graph.kruskal(), graph.prim(), graph.boruvka()}) {
+        EXPECT_EQ(result.total_weight, 16);
+        EXPECT_EQ(result.edges.size(), 4);
+    }
+
+    auto result = graph.kruskal();
+    EXPECT_EQ(result.edges[0], std::make_tuple(0, 1, 2));
+    EXPECT_EQ(result.edges[1], std::make_tuple(1, 2, 3));
+    EXPECT_EQ(result.edges[2], std::make_tuple(1, 4, 5));
+    EXPECT_EQ(result.edges[3], std::make_tuple(0, 3, 6));
+}
+
+TEST(SpanningForestTest, RandomGraphWithTies) {
+    // Few distinct weights, so the tie-breaking order decides most edges
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<int> vertex(0, 2999);
+    std::uniform_int_distribution<int> weight(1, 4);
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i < 9000; ++i) {
+        int a = vertex(rng);
+        int b = vertex(rng);
+        if (a != b) {
+            edges.emplace_back(a, b, weight(rng));
+        }
+    }
+    expect_same_forests(CsrGraph<int, int>::from_edge_list(edges));
+}
+
+TEST(SpanningForestTest, DisconnectedGraphWithNegativeWeights) {
+    std::vector<EdgeTuple> edges = {
+        {0, 1, -3}, {1, 2, 4}, {0, 2, -1},
+        {5, 6, 0}, {6, 7, -2}, {5, 7, 10},
+        {9, 10, 1}
+    };
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    expect_same_forests(csr);
+    EXPECT_EQ(csr.kruskal().total_weight, -3 - 1 + 0 - 2 + 1);
+    EXPECT_EQ(csr.kruskal().edges.size(), 5);
+}
+
+TEST(SpanningForestTest, LongHookingChain) {
+    // Each vertex's lightest edge points to its predecessor, so one Boruvka round hooks a path of them
+    std::vector<EdgeTuple> edges;
+    for (int i = 0; i + 1 < 5000; ++i) {
+        edges.emplace_back(i, i + 1, i);
+        if (i + 2 < 5000) {
+            edges.emplace_back(i, i + 2, 10000 + i);
+        }
+    }
+    auto csr = CsrGraph<int, int>::from_edge_list(edges);
+    expect_same_forests(csr);
+    EXPECT_EQ(csr.boruvka().edges.size(), 4999);
+}
+
+TEST(SpanningForestTest, EmptyGraphThrows) {
+    Graph<int, int, int> graph;
+    EXPECT_THROW(graph.kruskal(), std::runtime_error);
+    EXPECT_THROW(graph.prim(), std::runtime_error);
+    EXPECT_THROW(graph.boruvka(), std::runtime_error);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "../include/graph.hpp"
+
+class WorkspaceTest : public ::testing::Test {
+protected:
+    Graph<int, int, int> graph;
+    Graph<int, int, int> reference; // same graph, queried through the mutating overloads
+
+    static void build(Graph<int, int, int>& target) {
+        target.generate_grid_graph(20, 20);
+        target.add_vertex(1000, 0);
+        target.add_vertex(1001, 0);
+        target.add_edge(1000, 1001, 3);
+    }
+
+    void SetUp() override {
+        build(graph);
+        build(reference);
+    }
+};
+
+TEST_F(WorkspaceTest, ConstQueriesMatchMutatingOnes) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace workspace;
+
+    auto bfs = shared.breadth_first_search(0, workspace);
+    auto expected_bfs = reference.breadth_first_search(0);
+    EXPECT_EQ(bfs.order.size(), expected_bfs.order.size());
+    for (const auto& [id, time] : expected_bfs.discovery_time) {
+        EXPECT_EQ(bfs.discovery_time.at(id), time);
+        EXPECT_EQ(bfs.finish_time.at(id), expected_bfs.finish_time.at(id));
+    }
+
+    auto dfs = shared.depth_first_search(5, workspace);
+    auto expected_dfs = reference.depth_first_search(5);
+    for (const auto& [id, time] : expected_dfs.finish_time) {
+        EXPECT_EQ(dfs.finish_time.at(id), time);
+    }
+
+    auto paths = shared.dijkstra(0, workspace);
+    auto expected_paths = reference.dijkstra(0);
+    EXPECT_EQ(paths.distances.size(), expected_paths.distances.size());
+    for (const auto& [id, distance] : expected_paths.distances) {
+        EXPECT_EQ(paths.distances.at(id), distance);
+    }
+
+    auto hops = shared.shortest_paths_unweighted(1000, workspace);
+    EXPECT_EQ(hops.distances.size(), 2);
+    EXPECT_EQ(hops.distances.at(1001), 1);
+
+    auto coloring = shared.greedy_coloring(0, workspace);
+    auto expected_coloring = reference.greedy_coloring(0);
+    EXPECT_EQ(coloring.color_count, expected_coloring.color_count);
+
+    EXPECT_EQ(shared.find_connected_components(workspace).size(), 2);
+}
+
+TEST_F(WorkspaceTest, ConstQueriesLeaveVerticesUntouched) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace workspace;
+
+    shared.breadth_first_search(0, workspace);
+    shared.depth_first_search(0, workspace);
+    shared.dijkstra(0, workspace);
+    shared.greedy_coloring(0, workspace);
+
+    for (const auto& [id, vertex] : graph.get_vertices()) {
+        EXPECT_EQ(vertex.get_color(), 0);
+        EXPECT_EQ(vertex.get_discovery_time(), -1);
+        EXPECT_EQ(vertex.get_finish_time(), -1);
+    }
+}
+
+TEST_F(WorkspaceTest, WorkspaceFollowsGraphSize) {
+    Graph<int, int, int>::Workspace workspace;
+    graph.breadth_first_search(0, workspace);
+    EXPECT_EQ(workspace.slot_count(), graph.vertex_count());
+
+    Graph<int, int, int> small;
+    small.generate_path_graph(3);
+    auto result = small.breadth_first_search(0, workspace);
+    EXPECT_EQ(result.order.size(), 3);
+    EXPECT_EQ(workspace.slot_count(), 3);
+}
+
+TEST_F(WorkspaceTest, ConcurrentQueriesOnSharedGraph) {
+    const auto& shared = graph;
+    auto expected = reference.dijkstra(0);
+
+    std::vector<int> mismatches(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < mismatches.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            Graph<int, int, int>::Workspace workspace;
+            for (int round = 0; round < 20; ++round) {
+                auto paths = shared.dijkstra(0, workspace);
+                for (const auto& [id, distance] : expected.distances) {
+                    mismatches[t] += paths.distances.at(id) != distance;
+                }
+                mismatches[t] += shared.breadth_first_search(round, workspace).order.size() != 400;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+}
+
+TEST_F(WorkspaceTest, ReusedWorkspaceStartsEveryQueryClean) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace workspace(graph.vertex_count());
+    Graph<int, int, int>::Workspace fresh;
+    auto expected_coloring = shared.greedy_coloring(0, fresh);
+
+    // Alternate between a tiny component and the grid; nothing may leak from one query into the next
+    for (int round = 0; round < 5; ++round) {
+        auto small = shared.dijkstra(1000, workspace);
+        EXPECT_EQ(small.distances.size(), 2);
+        EXPECT_EQ(small.distances.at(1001), 3);
+
+        auto large = shared.breadth_first_search(399, workspace);
+        EXPECT_EQ(large.order.size(), 400);
+        EXPECT_FALSE(large.reached(1000));
+
+        auto components = shared.find_connected_components(workspace);
+        EXPECT_EQ(components.size(), 2);
+
+        auto coloring = shared.greedy_coloring(0, workspace);
+        EXPECT_EQ(coloring.color_count, expected_coloring.color_count);
+        for (const auto& [id, color] : expected_coloring.colors) {
+            EXPECT_EQ(coloring.colors.at(id), color);
+        }
+    }
+}
+
+TEST_F(WorkspaceTest, NegativeWeightsTrackedThroughMutations) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace workspace;
+
+    graph.set_edge_weight(1000, 1001, -1);
+    EXPECT_THROW(shared.dijkstra(0, workspace), std::runtime_error);
+
+    graph.set_edge_weight(1000, 1001, 2);
+    EXPECT_NO_THROW(shared.dijkstra(0, workspace));
+
+    graph.set_edge_weight(1000, 1001, -5);
+    graph.remove_edge(1000, 1001);
+    EXPECT_NO_THROW(shared.dijkstra(0, workspace));
+}
+
+TEST_F(WorkspaceTest, QueueIsReusedAcrossQueriesAndPolicies) {
+    const auto& shared = graph;
+    Graph<int, int, int>::Workspace workspace;
+    auto expected = reference.dijkstra<BinaryHeap>(0);
+
+    // Switching policies and weights must hand every query an empty queue of the right size
+    for (int round = 0; round < 3; ++round) {
+        auto indexed = shared.dijkstra<IndexedFourAryHeap>(0, workspace);
+        auto dial = shared.dijkstra<DialBuckets>(0, workspace);
+        auto radix = shared.dijkstra<RadixHeap>(0, workspace);
+        for (const auto& [id, distance] : expected.distances) {
+            EXPECT_EQ(indexed.distances.at(id), distance);
+            EXPECT_EQ(dial.distances.at(id), distance);
+            EXPECT_EQ(radix.distances.at(id), distance);
+        }
+        EXPECT_EQ(shared.dijkstra<DialBuckets>(1000, workspace).distances.at(1001), 3 + round);
+
+        graph.set_edge_weight(1000, 1001, 4 + round);
+    }
+}